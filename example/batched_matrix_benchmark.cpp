@@ -0,0 +1,216 @@
+//  Boost Batched Small Matrix benchmark example file  -----------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+//  Times linear algebra on many independent 4x4 matrices, both one
+//  `array_md` at a time and with the interleaved batched kernels, and reports
+//  matrices per second.  (Build with optimization, and vectorization enabled,
+//  for meaningful numbers.)
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/batched_matrix.hpp"
+
+
+namespace
+{
+    std::size_t const  order = 4u;
+
+    typedef boost::container::array_md<double, 4, 4>  matrix;
+    typedef boost::container::array_md<double, 4, 1>  column;
+
+    //  Per-object versions  -------------------------------------------------//
+
+    matrix  scalar_multiply( matrix const &a, matrix const &b )
+    {
+        matrix  result{};
+
+        for ( std::size_t  r = 0u ; r < order ; ++r )
+            for ( std::size_t  k = 0u ; k < order ; ++k )
+                for ( std::size_t  c = 0u ; c < order ; ++c )
+                    result[ r ][ c ] += a[ r ][ k ] * b[ k ][ c ];
+        return result;
+    }
+
+    // Gaussian elimination with partial pivoting, carrying `columns`
+    // right-hand sides; returns the determinant.
+    double  scalar_eliminate( matrix &w, double *x, std::size_t columns )
+    {
+        double  det = 1.;
+
+        for ( std::size_t  k = 0u ; k < order ; ++k )
+        {
+            auto  p = k;
+
+            for ( auto  r = k + 1u ; r < order ; ++r )
+                if ( std::abs(w[ r ][ k ]) > std::abs(w[ p ][ k ]) )
+                    p = r;
+            if ( p != k )
+            {
+                std::swap( w[k], w[p] );
+                for ( std::size_t  c = 0u ; c < columns ; ++c )
+                    std::swap( x[k * columns + c], x[p * columns + c] );
+                det = -det;
+            }
+            det *= w[ k ][ k ];
+            for ( auto  r = k + 1u ; r < order ; ++r )
+            {
+                auto const  f = w[ r ][ k ] /= w[ k ][ k ];
+
+                for ( auto  c = k + 1u ; c < order ; ++c )
+                    w[ r ][ c ] -= f * w[ k ][ c ];
+                for ( std::size_t  c = 0u ; c < columns ; ++c )
+                    x[ r * columns + c ] -= f * x[ k * columns + c ];
+            }
+        }
+        for ( auto  r = order ; r-- ; )
+            for ( std::size_t  c = 0u ; c < columns ; ++c )
+            {
+                for ( auto  j = r + 1u ; j < order ; ++j )
+                    x[ r * columns + c ] -= w[ r ][ j ] * x[ j * columns + c ];
+                x[ r * columns + c ] /= w[ r ][ r ];
+            }
+        return det;
+    }
+
+    double  scalar_determinant( matrix a )
+    { return scalar_eliminate(a, nullptr, 0u); }
+
+    matrix  scalar_inverse( matrix a )
+    {
+        matrix  result{};
+
+        for ( std::size_t  k = 0u ; k < order ; ++k )
+            result[ k ][ k ] = 1.;
+        scalar_eliminate( a, &result[0][0], order );
+        return result;
+    }
+
+    column  scalar_solve( matrix a, column b )
+    {
+        scalar_eliminate( a, &b[0][0], 1u );
+        return b;
+    }
+
+    matrix  scalar_cholesky( matrix const &a )
+    {
+        matrix  result{};
+
+        for ( std::size_t  j = 0u ; j < order ; ++j )
+            for ( auto  i = j ; i < order ; ++i )
+            {
+                double  sum = a[ i ][ j ];
+
+                for ( std::size_t  k = 0u ; k < j ; ++k )
+                    sum -= result[ i ][ k ] * result[ j ][ k ];
+                result[ i ][ j ] = i == j ? std::sqrt( sum ) : sum / result[ j
+                 ][ j ];
+            }
+        return result;
+    }
+
+    //  Timing  --------------------------------------------------------------//
+
+    // The best of several runs, to keep other load from skewing the ratios
+    template < typename Function >
+    double  seconds( Function &&f )
+    {
+        double  best = 0.;
+
+        for ( int  run = 0 ; run < 7 ; ++run )
+        {
+            auto const  start = std::chrono::steady_clock::now();
+
+            f();
+
+            double const  t = std::chrono::duration<double>(
+             std::chrono::steady_clock::now() - start ).count();
+
+            best = run && best < t ? best : t;
+        }
+        return best;
+    }
+
+    void  report( char const *name, std::size_t count, double scalar, double
+     batched )
+    {
+        std::cout << "  " << std::left << std::setw( 12 ) << name << std::right
+         << std::setprecision( 0 ) << std::setw( 14 ) << count / scalar <<
+         std::setw( 14 ) << count / batched << std::setprecision( 2 ) <<
+         std::setw( 10 ) << scalar / batched << '\n';
+    }
+}
+
+
+int  main()
+{
+    using boost::container::batched_matrix;
+
+    std::size_t const  count = 1u << 20;
+
+    // Symmetric, diagonally dominant matrices: invertible and positive-definite
+    std::vector<matrix>  source( count );
+    std::vector<column>  rhs( count );
+
+    for ( std::size_t  i = 0u ; i < count ; ++i )
+        for ( std::size_t  r = 0u ; r < order ; ++r )
+        {
+            for ( std::size_t  c = 0u ; c < order ; ++c )
+                source[ i ][ r ][ c ] = double( (i + r * c * 7u) % 13u ) / 16. +
+                 ( r == c ? 4. : 0. );
+            rhs[ i ][ r ][ 0 ] = double( i % 7u + r );
+        }
+
+    // Outputs are allocated up front for both versions
+    batched_matrix<double, 4, 4>  a( source.begin(), source.end() ), c( count );
+    batched_matrix<double, 4, 1>  b( rhs.begin(), rhs.end() ), x( count );
+    std::vector<matrix>           out( count );
+    std::vector<column>           out_column( count );
+    std::vector<double>           out_scalar( count ), det( count );
+
+    std::cout << std::fixed << std::setprecision( 0 ) << count << " 4x4 double"
+     " matrices, matrices per second\n  " << std::left << std::setw( 12 ) <<
+     "kernel" << std::right << std::setw( 14 ) << "per-object" << std::setw( 14
+     ) << "batched" << std::setw( 10 ) << "speed-up" << '\n';
+
+    report( "multiply", count, seconds([&]{
+        for ( std::size_t  i = 0u ; i < count ; ++i )
+            out[ i ] = scalar_multiply( source[i], source[i] );
+    }), seconds([&]{ multiply( a, a, c, 1u ); }) );
+    report( "determinant", count, seconds([&]{
+        for ( std::size_t  i = 0u ; i < count ; ++i )
+            out_scalar[ i ] = scalar_determinant( source[i] );
+    }), seconds([&]{ determinant( a, det, 1u ); }) );
+    report( "inverse", count, seconds([&]{
+        for ( std::size_t  i = 0u ; i < count ; ++i )
+            out[ i ] = scalar_inverse( source[i] );
+    }), seconds([&]{ inverse( a, c, 1u ); }) );
+    report( "LU solve", count, seconds([&]{
+        for ( std::size_t  i = 0u ; i < count ; ++i )
+            out_column[ i ] = scalar_solve( source[i], rhs[i] );
+    }), seconds([&]{ lu_solve( a, b, x, 1u ); }) );
+    report( "Cholesky", count, seconds([&]{
+        for ( std::size_t  i = 0u ; i < count ; ++i )
+            out[ i ] = scalar_cholesky( source[i] );
+    }), seconds([&]{ cholesky( a, c, 1u ); }) );
+
+    // Compare the last results of each version
+    auto const  last = count - 1u;
+
+    return std::abs( out_scalar[last] - det[last] ) < 1e-9 && std::abs(
+     out_column[last][3][0] - x(last, 3, 0) ) < 1e-9 && std::abs(
+     out[last][3][3] - c(last, 3, 3) ) < 1e-9 ? 0 : 1;
+}
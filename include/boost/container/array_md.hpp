@@ -1618,9 +1618,410 @@ namespace detail
         >::type  type;
     };
 
+    //! The value at the given position of a list; zero if past the end.
+    constexpr
+    std::size_t  pack_at( std::size_t ) noexcept  { return 0u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_at( std::size_t i, std::size_t first, Rest ...rest )
+     noexcept
+    { return i ? pack_at( i - 1u, rest... ) : first; }
+
+    //! The number of times a value appears in a list.
+    constexpr
+    std::size_t  pack_count( std::size_t ) noexcept  { return 0u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_count( std::size_t v, std::size_t first, Rest ...rest )
+     noexcept
+    { return ( v == first ) + pack_count( v, rest... ); }
+
+    //! The position of a value in a list; the length if absent.
+    constexpr
+    std::size_t  pack_find( std::size_t ) noexcept  { return 0u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_find( std::size_t v, std::size_t first, Rest ...rest )
+     noexcept
+    { return v == first ? 0u : 1u + pack_find( v, rest... ); }
+
+    //! The sum of a list.
+    constexpr
+    std::size_t  pack_sum() noexcept  { return 0u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_sum( std::size_t first, Rest ...rest ) noexcept
+    { return first + pack_sum( rest... ); }
+
+    //! The product of a list.
+    constexpr
+    std::size_t  pack_product() noexcept  { return 1u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_product( std::size_t first, Rest ...rest ) noexcept
+    { return first * pack_product( rest... ); }
+
+    //! The row-major stride of the given axis of a list of extents.
+    constexpr
+    std::size_t  pack_stride( std::size_t ) noexcept  { return 1u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_stride( std::size_t axis, std::size_t, Rest ...rest )
+     noexcept
+    {
+        return axis ? pack_stride( axis - 1u, rest... ) : pack_product( rest...
+         );
+    }
+
+    //! The product of the first *n* values of a list.
+    constexpr
+    std::size_t  pack_head_product( std::size_t ) noexcept  { return 1u; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    std::size_t  pack_head_product( std::size_t n, std::size_t first, Rest
+     ...rest ) noexcept
+    { return n ? first * pack_head_product( n - 1u, rest... ) : 1u; }
+
+    //! Whether every value of a list is set.
+    constexpr
+    bool  pack_all() noexcept  { return true; }
+    //! \overload
+    template < typename ...Rest >
+    constexpr
+    bool  pack_all( bool first, Rest ...rest ) noexcept
+    { return first && pack_all( rest... ); }
+
+    //! Whether a list has each of 0 to its length minus one exactly once.
+    template < std::size_t ...P >
+    constexpr
+    bool  is_permutation_pack() noexcept
+    { return pack_all( (P < sizeof...( P ) && pack_count(P, P...) == 1u)... ); }
+
+    //! Row-major strides of a list of extents, as a sequence
+    template < class Indices, class Extents > struct row_major_stride_seq;
+    //! Row-major strides of a list of extents, actual work
+    template < std::size_t ...I, std::size_t ...D >
+    struct row_major_stride_seq< seq<I...>, seq<D...> >
+    { typedef seq< pack_stride(I, D...)... > type; };
+
+    //! The result of joining arrays along an axis, prototype
+    template < std::size_t Axis, class Indices, class ...Arrays >
+    struct concatenated_array_impl;
+    //! The result of joining arrays along an axis, base case
+    template < std::size_t Axis, std::size_t ...I, typename T,
+     std::size_t ...N >
+    struct concatenated_array_impl< Axis, seq<I...>,
+     boost::container::array_md<T, N...> >
+    { typedef boost::container::array_md<T, N...>  type; };
+    //! The result of joining arrays along an axis, recursive case
+    template < std::size_t Axis, std::size_t ...I, typename T, std::size_t ...N,
+     typename U, std::size_t ...M, class ...Arrays >
+    struct concatenated_array_impl< Axis, seq<I...>,
+     boost::container::array_md<T, N...>, boost::container::array_md<U, M...>,
+     Arrays... >
+    {
+        static_assert( std::is_same<T, U>::value, "Element types must match" );
+        static_assert( sizeof...(N) == sizeof...(M), "Ranks must match" );
+        static_assert( pack_all((I == Axis || N == M)...), "Extents off the "
+         "joined axis must match" );
+
+        typedef typename concatenated_array_impl< Axis, seq<I...>,
+         boost::container::array_md<T, (I == Axis ? N + M : N)...>, Arrays...
+         >::type  type;
+    };
+    //! The result of joining arrays along an axis
+    template < std::size_t Axis, class Array, class ...Arrays >
+    struct concatenated_array
+        : concatenated_array_impl< Axis, typename
+          gen_seq<Array::dimensionality>::type, Array, Arrays... >
+    { };
+
+    //! Copy the *o*th contiguous run of each array, in turn.
+    template < std::size_t Outer, typename T >
+    T *  concat_runs( T *d, std::size_t )  { return d; }
+    //! \overload
+    template < std::size_t Outer, typename T, class Array, class ...Arrays >
+    T *  concat_runs( T *d, std::size_t o, Array const &a, Arrays const &...b )
+    {
+        constexpr std::size_t  run = Outer ? Array::static_size / Outer : 0u;
+
+        return concat_runs<Outer>( std::copy_n(a.data() + o * run, run, d), o,
+         b... );
+    }
+
+    //! Shapes at or below this many elements transpose with an unrolled copy.
+    constexpr std::size_t  transpose_unroll_limit = 64u;
+    //! Side length of the square tiles used to transpose larger shapes.
+    constexpr std::size_t  transpose_block = 16u;
+
+    /* Copies elements into transposed order.  `D` are the destination extents,
+       `DS` their row-major strides, and `S` the source strides rearranged to
+       match the destination axes.  `Q` is the destination axis that is
+       contiguous in the source.
+     */
+    template < typename T, std::size_t Q, class Extents, class DestStrides,
+     class SourceStrides >
+    struct transposer;
+    //! Copy elements into transposed order, actual work
+    template < typename T, std::size_t Q, std::size_t ...D, std::size_t ...DS,
+     std::size_t ...S >
+    struct transposer< T, Q, seq<D...>, seq<DS...>, seq<S...> >
+    {
+        //! Where the destination's *k*th element is in the source.
+        static constexpr
+        std::size_t  source_offset( std::size_t k ) noexcept
+        { return pack_sum( (k / DS % D * S)... ); }
+
+        //! Copy all the elements, every offset computed at compile time.
+        template < std::size_t ...K >
+        static
+        void  copy( T const *s, T *d, std::true_type, seq<K...> )
+        {
+            int  dummy[] = { 0, (d[ K ] = s[ std::integral_constant<std::size_t,
+             source_offset(K)>::value ], 0)... };
+
+            (void)dummy;
+        }
+
+        //! Copy all the elements, a tile at a time.
+        template < typename Unused >
+        static
+        void  copy( T const *s, T *d, std::false_type, Unused )
+        {
+            using std::size_t;
+            using std::min;
+
+            constexpr size_t  rank = sizeof...( D ), last = rank - 1u;
+            size_t const      extent[] = { D... }, dstride[] = { DS... },
+                              sstride[] = { S... };
+            size_t            planes = 1u;
+
+            for ( size_t  a = 0u ; a < last ; ++a )
+                planes *= a == Q ? 1u : extent[ a ];
+            for ( size_t  p = 0u ; p < planes ; ++p )
+            {
+                // Locate the plane spanned by axes Q and last
+                size_t  r = p, db = 0u, sb = 0u;
+
+                for ( size_t  a = last ; a-- ; )
+                    if ( a != Q )
+                    {
+                        db += r % extent[ a ] * dstride[ a ];
+                        sb += r % extent[ a ] * sstride[ a ];
+                        r /= extent[ a ];
+                    }
+                if ( Q == last )
+                {
+                    // The innermost axis doesn't move; copy whole rows.
+                    std::copy_n( s + sb, extent[last], d + db );
+                    continue;
+                }
+
+                // Tiles are small enough that both the rows written and the
+                // (differently-strided) rows read stay in cache.
+                for ( size_t  jb = 0u ; jb < extent[Q] ; jb += transpose_block )
+                    for (size_t  ib = 0u ; ib < extent[last] ; ib +=
+                     transpose_block)
+                    {
+                        size_t const  je = min( jb + transpose_block,
+                         extent[Q] ), ie = min( ib + transpose_block,
+                         extent[last] );
+
+                        for ( size_t  j = jb ; j < je ; ++j )
+                            for ( size_t  i = ib ; i < ie ; ++i )
+                                d[ db + j * dstride[Q] + i ] = s[ sb + j *
+                                 sstride[Q] + i * sstride[last] ];
+                    }
+            }
+        }
+    };
+
+}  // namespace detail
+//! \endcond
+
+
+//  Multi-dimensional array reference class template definition  -------------//
+
+template < typename T, std::size_t ...N >
+class array_md_ref;
+
+//! \cond
+namespace detail
+{
+    //! What indexing the first axis of an `array_md_ref` gives: a view of the
+    //! remaining axes, or an element if there are none.  (Nothing for a view
+    //! without axes.)
+    template < typename T, std::size_t ...N >
+    struct array_md_ref_slice
+    {};
+    //! \overload
+    template < typename T, std::size_t M, std::size_t ...N >
+    struct array_md_ref_slice<T, M, N...>
+    {
+        typedef array_md_ref<T, N...>  type;
+
+        static constexpr  std::size_t  stride = pack_product( N... );
+
+        static  type  make( T *p ) noexcept  { return type( p ); }
+    };
+    //! \overload
+    template < typename T, std::size_t M >
+    struct array_md_ref_slice<T, M>
+    {
+        typedef T &  type;
+
+        static constexpr  std::size_t  stride = 1u;
+
+        static  type  make( T *p ) noexcept  { return *p; }
+    };
+
 }  // namespace detail
 //! \endcond
 
+/** \brief  A view of contiguous elements with a compile-time shape.
+
+Provides the element access of an `array_md` (chained `operator []`, `operator
+()` with every index, and iteration in row-major order) over elements it does
+**not** own, like those of an `array_md` seen through #reshape.  Copying a view
+copies the reference, not the elements; the elements must outlive all views of
+them.  Element access follows the constness of the view object, like a
+container.
+
+    \tparam T  The element type.  Use a `const`-qualified type to view
+               read-only elements.
+    \tparam N  The size of each dimension.  May be empty for a single element.
+ */
+template < typename T, std::size_t ...N >
+class array_md_ref
+{
+public:
+    // Types
+    //! The type of the elements.
+    typedef typename std::remove_cv<T>::type  value_type;
+    //! The type for size-based meta-data.
+    typedef std::size_t                        size_type;
+    //! The type for referring to an element.
+    typedef T &                                reference;
+    //! The type for referring to an element, read-only.
+    typedef value_type const &           const_reference;
+    //! The type for pointing to an element.
+    typedef T *                                  pointer;
+    //! The type for pointing to an element, read-only.
+    typedef value_type const *             const_pointer;
+    //! The type for iterating over the elements.
+    typedef pointer                             iterator;
+    //! The type for iterating over the elements, read-only.
+    typedef const_pointer                 const_iterator;
+
+    //! The number of extents.
+    static constexpr  size_type  dimensionality = sizeof...( N );
+    //! The number of elements.
+    static constexpr  size_type  static_size = detail::pack_product( N... );
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  View memory as an array of this shape.
+        \pre  `[p, p + static_size)` is a valid range.
+        \param p  The address of the first element, in row-major order.
+     */
+    explicit constexpr  array_md_ref( pointer p ) noexcept  : first( p )  {}
+
+    // Observers
+    //! \returns  #static_size
+    constexpr  size_type  size() const noexcept  { return static_size; }
+
+    //! \returns  The address of the first element viewed.
+    pointer        data()       noexcept  { return first; }
+    //! \overload
+    const_pointer  data() const noexcept  { return first; }
+
+    // Access
+    /** \brief  Access to an element, full depth.
+        \pre  `sizeof...(i) == dimensionality`, and each index is less than its
+              extent.  Not checked.
+        \param i  The list of indexes needed to locate the element.
+        \returns  A reference to the element.
+     */
+    template < typename ...Indices >
+    reference        operator ()( Indices ...i ) noexcept
+    { return first[ offset(i...) ]; }
+    //! \overload
+    template < typename ...Indices >
+    const_reference  operator ()( Indices ...i ) const noexcept
+    { return first[ offset(i...) ]; }
+
+    /** \brief  Access to a slice along the first axis.
+        \pre  `dimensionality > 0`, and `i` is less than the first extent.
+        \param i  The index along the first axis.
+        \returns  A view of the elements with that first index, or a reference
+                  to the element if #dimensionality is 1.
+     */
+    template < typename U = T >
+    auto  operator []( size_type i ) noexcept -> typename
+     detail::array_md_ref_slice<U, N...>::type
+    {
+        typedef detail::array_md_ref_slice<U, N...>  slice;
+
+        return slice::make( first + i * slice::stride );
+    }
+    //! \overload
+    template < typename U = value_type const >
+    auto  operator []( size_type i ) const noexcept -> typename
+     detail::array_md_ref_slice<U, N...>::type
+    {
+        typedef detail::array_md_ref_slice<U, N...>  slice;
+
+        return slice::make( first + i * slice::stride );
+    }
+
+    // Iteration, in row-major order
+    //! \returns  #data()
+    iterator        begin()       noexcept  { return first; }
+    //! \overload
+    const_iterator  begin() const noexcept  { return first; }
+    //! \returns  `data() + static_size`
+    iterator          end()       noexcept  { return first + static_size; }
+    //! \overload
+    const_iterator    end() const noexcept  { return first + static_size; }
+
+private:
+    template < typename ...Indices >
+    static  size_type  offset( Indices ...i ) noexcept
+    {
+        static_assert( sizeof...(i) == dimensionality, "Need one index per "
+         "axis" );
+
+        size_type const  e[] = { N..., 0u };
+        size_type const  x[] = { static_cast<size_type>(i)..., 0u };
+        size_type        result = 0u;
+
+        for ( size_type  d = 0u ; d < dimensionality ; ++d )
+            result = result * e[ d ] + x[ d ];
+        return result;
+    }
+
+    pointer  first;
+};
+
+//! Gives definition to the number of extents.
+template < typename T, std::size_t ...N >
+constexpr
+typename array_md_ref<T, N...>::size_type
+  array_md_ref<T, N...>::dimensionality;
+
+//! Gives definition to the number of elements.
+template < typename T, std::size_t ...N >
+constexpr
+typename array_md_ref<T, N...>::size_type
+  array_md_ref<T, N...>::static_size;
+
 
 //  Multi-dimensional array class template, creation functions  --------------//
 
@@ -1791,6 +2192,229 @@ auto  unmake_nested( array_md<T, N...> const &source ) -> typename
     return result;
 }
 
+/** \brief  View an array's elements with a different shape, without copying.
+
+Since the elements of an `array_md` are stored contiguously in row-major order,
+they can be walked with any shape that has the same element count.  This
+function gives an #array_md_ref of the new shape over the given array's
+elements, so `reshape<24>( a )` with `a` of type `array_md<T, 6, 4>` refers to
+the same 24 elements as a linear array.  Element `k` in iteration order is the
+same object in both.
+
+    \pre  The new shape has the same number of elements as the old one (checked
+          at compile time).
+
+    \tparam M  The size of each dimension of the new shape.  May be empty if
+               there is a single element.
+
+    \param source  The array to reshape.
+
+    \returns  A view of the elements of `source` as an `array_md<T, M...>`.  It
+              is valid as long as `source` is.
+ */
+template < std::size_t ...M, typename T, std::size_t ...N >
+inline
+array_md_ref<T, M...>  reshape( array_md<T, N...> &source ) noexcept
+{
+    static_assert( array_md_ref<T, M...>::static_size == array_md<T,
+     N...>::static_size, "Reshaping can't change the number of elements" );
+
+    return array_md_ref<T, M...>( source.data() );
+}
+
+//! \overload
+template < std::size_t ...M, typename T, std::size_t ...N >
+inline
+array_md_ref<T const, M...>  reshape( array_md<T, N...> const &source ) noexcept
+{
+    static_assert( array_md_ref<T const, M...>::static_size == array_md<T,
+     N...>::static_size, "Reshaping can't change the number of elements" );
+
+    return array_md_ref<T const, M...>( source.data() );
+}
+
+//! A reshaped view of a temporary would dangle.
+template < std::size_t ...M, typename T, std::size_t ...N >
+void  reshape( array_md<T, N...> && ) = delete;
+
+//! \overload
+template < std::size_t ...M, typename T, std::size_t ...N >
+inline
+array_md_ref<T, M...>  reshape( array_md_ref<T, N...> source ) noexcept
+{
+    static_assert( array_md_ref<T, M...>::static_size == array_md_ref<T,
+     N...>::static_size, "Reshaping can't change the number of elements" );
+
+    return array_md_ref<T, M...>( source.data() );
+}
+
+/** \brief  Copy an array with its axes rearranged.
+
+Makes a new `array_md` object whose axis *k* is axis `P[k]` of the source, so
+`transpose<1, 0>( a )` is the usual matrix transpose and, for `a` of type
+`array_md<T, 2, 3, 4>`, `transpose<2, 0, 1>( a )` has type `array_md<T, 4, 2,
+3>` with `result( i, j, k ) == a( j, k, i )`.
+
+The copy pattern is picked at compile time.  Small shapes use a fully unrolled
+copy with every element's source offset computed by the compiler.  Larger
+shapes copy square tiles between the destination's innermost axis and the axis
+that's innermost in the source, so neither side strides through memory more
+than a tile's worth at a time.
+
+    \pre  `P...` is a permutation of `0`, ..., `sizeof...(N) - 1` (checked at
+          compile time).
+    \pre  `T` is Default-Constructible and Copy-Assignable.
+
+    \tparam P  The source axis for each axis of the result.
+
+    \param source  The array to transpose.
+
+    \throws Whatever  default-construction or copy-assignment of `T` throws.
+
+    \returns  An array *x* such that `x( i[0], ..., i[R - 1] )` is equivalent to
+              `source( j[0], ..., j[R - 1] )`, where `j[P[k]] == i[k]`.
+
+    \see  #transpose_in_place
+ */
+template < std::size_t ...P, typename T, std::size_t ...N >
+auto  transpose( array_md<T, N...> const &source )
+ -> array_md<T, detail::pack_at( P, N... )...>
+{
+    using detail::seq;
+    using detail::pack_at;
+
+    static_assert( sizeof...(P) == sizeof...(N), "Need one index per axis" );
+    static_assert( detail::is_permutation_pack<P...>(), "Axes must be listed "
+     "once each" );
+
+    typedef array_md<T, pack_at( P, N... )...>  result_type;
+    typedef detail::transposer<T, detail::pack_find( sizeof...(N) - 1u, P... ),
+     seq<pack_at( P, N... )...>, typename detail::row_major_stride_seq<typename
+     detail::gen_seq<sizeof...( N )>::type, seq<pack_at( P, N... )...>>::type,
+     seq<detail::pack_stride( P, N... )...>>  transposer_type;
+
+    result_type  result;
+
+    transposer_type::copy( source.data(), result.data(), std::integral_constant<
+     bool, (result_type::static_size <= detail::transpose_unroll_limit)>{},
+     detail::make_int_seq<result_type::static_size <=
+     detail::transpose_unroll_limit ? result_type::static_size : 0u>() );
+    return result;
+}
+
+/** \brief  Transpose a square matrix in place.
+
+Exchanges each element off the main diagonal with its mirror image, working on
+square tiles so that the rows and columns being exchanged stay in cache.
+
+    \pre  `T` is Swappable.
+
+    \param a  The matrix to transpose.
+
+    \throws Whatever  the element-level swap does.
+
+    \post  `a( i, j )` is equivalent to the old value of `a( j, i )`.
+
+    \see  #transpose
+ */
+template < typename T, std::size_t N >
+void  transpose_in_place( array_md<T, N, N> &a )
+ noexcept( detail::is_swap_nothrow<T>() )
+{
+    using std::size_t;
+    using std::min;
+    using std::swap;
+
+    constexpr size_t  block = detail::transpose_block;
+    T * const         d = a.data();
+
+    for ( size_t  ib = 0u ; ib < N ; ib += block )
+        for ( size_t  jb = ib ; jb < N ; jb += block )
+        {
+            size_t const  ie = min( ib + block, N ), je = min( jb + block, N );
+
+            for ( size_t  i = ib ; i < ie ; ++i )
+                for ( size_t  j = jb == ib ? i + 1u : jb ; j < je ; ++j )
+                    swap( d[i * N + j], d[j * N + i] );
+        }
+}
+
+/** \brief  Join arrays end to end along an axis.
+
+Makes a new `array_md` object holding the given arrays one after another along
+axis `Axis`, so joining two `array_md<T, N, M>` objects along axis 0 gives an
+`array_md<T, 2 * N, M>`, and along axis 1 an `array_md<T, N, 2 * M>`.  The
+arrays' other extents have to match.
+
+The elements of each array from a given index of the axes before `Axis` are
+contiguous in both it and the result, so each such run is copied as a block.
+(Joining along axis 0 copies each array in one block.)
+
+    \pre  `Axis < sizeof...(N)`.
+    \pre  Each of `b` is an `array_md<T, M...>` where `sizeof...(M) ==
+          sizeof...(N)`, and `M[k] == N[k]` for each *k* except `Axis`.  (All
+          checked at compile time.)
+    \pre  `T` is Default-Constructible and Copy-Assignable.
+
+    \tparam Axis  The axis to join along.
+
+    \param a  The first array.
+    \param b  The arrays following `a`.  May be empty.
+
+    \throws Whatever  default-construction or copy-assignment of `T` throws.
+
+    \returns  The joined array.
+
+    \see  #stack
+ */
+template < std::size_t Axis, typename T, std::size_t ...N, class ...Arrays >
+auto  concat( array_md<T, N...> const &a, Arrays const &...b ) -> typename
+ detail::concatenated_array<Axis, array_md<T, N...>, Arrays...>::type
+{
+    static_assert( Axis < sizeof...(N), "Axis out of range" );
+
+    constexpr std::size_t  outer = detail::pack_head_product( Axis, N... );
+
+    typename detail::concatenated_array<Axis, array_md<T, N...>,
+     Arrays...>::type  result;
+    T *               d = result.data();
+
+    for ( std::size_t  o = 0u ; o < outer ; ++o )
+        d = detail::concat_runs<outer>( d, o, a, b... );
+    return result;
+}
+
+/** \brief  Stack arrays along a new leading axis.
+
+Makes a new `array_md` object whose *k*th element along a new axis 0 is the
+*k*th array given, so stacking *K* `array_md<T, N...>` objects gives an
+`array_md<T, K, N...>`.  Each array is copied as one block.
+
+    \pre  Each of `b` is an `array_md<T, N...>` (checked at compile time).
+    \pre  `T` is Default-Constructible and Copy-Assignable.
+
+    \param a  The first array.
+    \param b  The arrays following `a`.  May be empty.
+
+    \throws Whatever  default-construction or copy-assignment of `T` throws.
+
+    \returns  The stacked array.
+
+    \see  #concat
+ */
+template < typename T, std::size_t ...N, class ...Arrays >
+auto  stack( array_md<T, N...> const &a, Arrays const &...b )
+ -> array_md<T, 1u + sizeof...( Arrays ), N...>
+{
+    static_assert( detail::pack_all(std::is_same<Arrays, array_md<T,
+     N...>>::value...), "Stacked arrays must have the same type" );
+
+    array_md<T, 1u + sizeof...( Arrays ), N...>  result;
+
+    detail::concat_runs<1u>( result.data(), 0u, a, b... );
+    return result;
+}
+
 
 //  Multi-dimensional array class template, other operations  ----------------//
 
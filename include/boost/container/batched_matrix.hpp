@@ -0,0 +1,673 @@
+//  Boost Batched Small Matrix header file  ----------------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template holding many small matrices interleaved, and
+      function templates doing linear algebra on all of them at once.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template storing a
+    batch of same-sized matrices, like `array_md<double, 4, 4>`, in groups with
+    the matrices' elements interleaved, and of function templates for products,
+    determinants, inverses, solving linear systems, and Cholesky factorization.
+    The kernels work a group at a time, with the innermost loop over the
+    matrices of the group, so each step of the algorithm is one contiguous,
+    branch-free loop the compiler can vectorize, instead of a short dependent
+    chain per matrix.
+
+    \warning  This library requires C++2011 features, including `std::thread`.
+ */
+
+#ifndef BOOST_CONTAINER_BATCHED_MATRIX_HPP
+#define BOOST_CONTAINER_BATCHED_MATRIX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Batched matrix class template definition  --------------------------------//
+
+/** \brief  Many small matrices, stored interleaved.
+
+The matrices are split into groups of `Lanes`.  Each group stores element
+`(0, 0)` of all its matrices, then element `(0, 1)` of all its matrices, and so
+on, so the same element of neighboring matrices is adjacent in memory.  The
+last group is padded with zero matrices.  The kernels that divide load identity
+matrices into those lanes instead, and clear them again before storing a group,
+so their results keep the zero padding.
+
+    \pre  `Rows > 0`, `Columns > 0`, and `Lanes > 0`.
+
+    \tparam T        The element type.
+    \tparam Rows     The number of rows in each matrix.
+    \tparam Columns  The number of columns in each matrix.
+    \tparam Lanes    The number of matrices interleaved together.  Best as a
+                     multiple of the number of `T` that fit in a vector
+                     register.  If not given, defaults to 8.
+ */
+template < typename T, std::size_t Rows, std::size_t Columns, std::size_t Lanes
+ = 8u >
+class batched_matrix
+{
+    static_assert( Rows && Columns && Lanes, "Need non-zero sizes" );
+
+public:
+    // Template parameters
+    //! The element type.  Gives access to its template parameter.
+    typedef T  value_type;
+    //! The number of rows.  Gives access to its template parameter.
+    static constexpr  std::size_t  row_count = Rows;
+    //! The number of columns.  Gives access to its template parameter.
+    static constexpr  std::size_t  column_count = Columns;
+    //! The matrices per group.  Gives access to its template parameter.
+    static constexpr  std::size_t  lane_count = Lanes;
+
+    // Other types
+    //! The type for size-based meta-data.
+    typedef std::size_t                     size_type;
+    //! The type of one matrix, outside of the batch.
+    typedef array_md<T, Rows, Columns>      matrix_type;
+
+    //! The number of elements in a group.
+    static constexpr  size_type  group_size = Rows * Columns * Lanes;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Make a batch of zero matrices.
+        \param count  The number of matrices.
+        \throws Whatever  memory allocation throws.
+        \post  `size() == count`.
+     */
+    explicit  batched_matrix( size_type count = 0u )
+      : n( count ), data( (count + Lanes - 1u) / Lanes * group_size )
+    {}
+    /** \brief  Make a batch from a sequence of matrices.
+        \param first  The start of the sequence.
+        \param last   The end of the sequence.
+        \throws Whatever  memory allocation or copying elements throws.
+        \post  `get( i ) == *(first + i)` for each matrix.
+     */
+    template < typename ForwardIterator >
+    batched_matrix( ForwardIterator first, ForwardIterator last )
+      : batched_matrix( static_cast<size_type>(std::distance( first, last )) )
+    {
+        for ( size_type  i = 0u ; first != last ; ++first )
+            set( i++, *first );
+    }
+
+    // Observers
+    //! \returns  The number of matrices.
+    size_type  size() const noexcept  { return n; }
+    //! \returns  The number of groups, including a partial one.
+    size_type  group_count() const noexcept
+    { return data.size() / group_size; }
+
+    // Access
+    /** \brief  Access an element of a matrix.
+        \pre  `i < size()`, `r < Rows`, and `c < Columns`.
+        \param i  The matrix.
+        \param r  The row.
+        \param c  The column.
+        \returns  A reference to the element.
+     */
+    value_type &  operator ()( size_type i, size_type r, size_type c )
+    { return data[ i / Lanes * group_size + (r * Columns + c) * Lanes + i %
+     Lanes ]; }
+    //! \overload
+    value_type const &  operator ()( size_type i, size_type r, size_type c )
+     const
+    { return data[ i / Lanes * group_size + (r * Columns + c) * Lanes + i %
+     Lanes ]; }
+
+    /** \brief  Copy a matrix out of the batch.
+        \param i  The matrix.
+        \throws std::out_of_range  if `i >= size()`.
+        \returns  The matrix, as a separate object.
+     */
+    matrix_type  get( size_type i ) const
+    {
+        matrix_type  result;
+
+        if ( i >= n )
+            throw std::out_of_range{ "Index too large" };
+        for ( size_type  r = 0u ; r < Rows ; ++r )
+            for ( size_type  c = 0u ; c < Columns ; ++c )
+                result[ r ][ c ] = ( *this )( i, r, c );
+        return result;
+    }
+    /** \brief  Copy a matrix into the batch.
+        \param i  The matrix.
+        \param m  The new value.
+        \throws std::out_of_range  if `i >= size()`.
+        \post  `get( i ) == m`.
+     */
+    void  set( size_type i, matrix_type const &m )
+    {
+        if ( i >= n )
+            throw std::out_of_range{ "Index too large" };
+        for ( size_type  r = 0u ; r < Rows ; ++r )
+            for ( size_type  c = 0u ; c < Columns ; ++c )
+                ( *this )( i, r, c ) = m[ r ][ c ];
+    }
+
+    /** \brief  Access a group's interleaved elements.
+        \pre  `g < group_count()`.
+        \param g  The group.
+        \returns  The first of its #group_size elements.  Element `(r, c)` of
+                  the group's matrix `l` is at offset `(r * Columns + c) *
+                  Lanes + l`.
+     */
+    value_type *  group_data( size_type g )  { return &data[g * group_size]; }
+    //! \overload
+    value_type const *  group_data( size_type g ) const
+    { return &data[g * group_size]; }
+
+private:
+    size_type                n;
+    std::vector<value_type>  data;
+};
+
+//! Gives definition to the number of rows.
+template < typename T, std::size_t Rows, std::size_t Columns, std::size_t Lanes
+ >
+constexpr
+std::size_t  batched_matrix<T, Rows, Columns, Lanes>::row_count;
+
+//! Gives definition to the number of columns.
+template < typename T, std::size_t Rows, std::size_t Columns, std::size_t Lanes
+ >
+constexpr
+std::size_t  batched_matrix<T, Rows, Columns, Lanes>::column_count;
+
+//! Gives definition to the number of matrices per group.
+template < typename T, std::size_t Rows, std::size_t Columns, std::size_t Lanes
+ >
+constexpr
+std::size_t  batched_matrix<T, Rows, Columns, Lanes>::lane_count;
+
+//! Gives definition to the number of elements per group.
+template < typename T, std::size_t Rows, std::size_t Columns, std::size_t Lanes
+ >
+constexpr
+typename batched_matrix<T, Rows, Columns, Lanes>::size_type
+  batched_matrix<T, Rows, Columns, Lanes>::group_size;
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Run a per-group kernel over all groups, splitting them among threads.
+    template < typename Function >
+    void  for_each_group( std::size_t groups, std::size_t group_work, unsigned
+     threads, Function &&f )
+    {
+        parallel_chunks( groups, thread_count_for(groups * group_work, threads),
+         [&]( std::size_t b, std::size_t e ){
+            for ( ; b < e ; ++b )
+                f( b );
+        } );
+    }
+
+    /** \brief  Copy a group of square matrices, with identity matrices in the
+                lanes past the end of the batch.
+        \details  The padding then never divides by zero.
+     */
+    template < typename T, std::size_t N, std::size_t L >
+    void  load_square_group( T const *source, T *w, std::size_t live )
+    {
+        std::copy( source, source + N * N * L, w );
+        for ( std::size_t  r = 0u ; r < N ; ++r )
+            for ( std::size_t  c = 0u ; c < N ; ++c )
+                std::fill( w + (r * N + c) * L + live, w + (r * N + c + 1u) *
+                 L, T(r == c) );
+    }
+
+    //! Zero the lanes past the end of the batch, in a group of `E` elements.
+    template < typename T, std::size_t E, std::size_t L >
+    void  clear_padding( T *w, std::size_t live )
+    {
+        for ( std::size_t  e = 0u ; e < E ; ++e )
+            std::fill( w + e * L + live, w + (e + 1u) * L, T() );
+    }
+
+    //! Swap the lanes of two interleaved rows where `chosen` is set.
+    template < std::size_t L, typename T >
+    void  swap_rows_where( T *a, T *b, std::size_t columns, bool const *chosen
+     )
+    {
+        for ( std::size_t  c = 0u ; c < columns ; ++c, a += L, b += L )
+            for ( std::size_t  l = 0u ; l < L ; ++l )
+            {
+                T const  x = a[ l ], y = b[ l ];
+
+                a[ l ] = chosen[ l ] ? y : x;
+                b[ l ] = chosen[ l ] ? x : y;
+            }
+    }
+
+    /** \brief  Gaussian elimination with partial pivoting on a group.
+
+    Reduces the `N`-by-`N` matrices in `w` to upper-triangular form, applying
+    the same row operations to the `N`-by-`C` matrices in `x`.  (What's left
+    below the diagonal of `w` is scratch.)  For each column, every lane's pivot
+    row is found first, with selects instead of a branch per matrix; then each
+    lower row is swapped with the current row, in the lanes that chose it, in
+    one pass.  `sign` gets the parity of each matrix's row swaps.
+     */
+    template < typename T, std::size_t N, std::size_t C, std::size_t L >
+    void  lu_group( T *w, T *x, T *sign )
+    {
+        using std::abs;
+
+        std::fill( sign, sign + L, T(1) );
+        for ( std::size_t  k = 0u ; k < N ; ++k )
+        {
+            std::size_t  pivot[ L ];
+            T            largest[ L ];
+
+            for ( std::size_t  l = 0u ; l < L ; ++l )
+            {
+                pivot[ l ] = k;
+                largest[ l ] = abs( w[(k * N + k) * L + l] );
+            }
+            for ( auto  r = k + 1u ; r < N ; ++r )
+                for ( std::size_t  l = 0u ; l < L ; ++l )
+                {
+                    T const     m = abs( w[(r * N + k) * L + l] );
+                    bool const  larger = m > largest[ l ];
+
+                    pivot[ l ] = larger ? r : pivot[ l ];
+                    largest[ l ] = larger ? m : largest[ l ];
+                }
+            for ( auto  r = k + 1u ; r < N ; ++r )
+            {
+                bool  chosen[ L ], any = false;
+
+                for ( std::size_t  l = 0u ; l < L ; ++l )
+                    any |= chosen[ l ] = pivot[ l ] == r;
+                if ( !any )
+                    continue;
+                for ( std::size_t  l = 0u ; l < L ; ++l )
+                    sign[ l ] = chosen[ l ] ? -sign[ l ] : sign[ l ];
+                swap_rows_where<L>( w + (k * N + k) * L, w + (r * N + k) * L, N
+                 - k, chosen );
+                swap_rows_where<L>( x + k * C * L, x + r * C * L, C, chosen );
+            }
+
+            // Eliminate below the pivots, from local copies of the pivot rows
+            // so the compiler sees the updated rows can't overlap them.
+            T  wk[ N * L ], xk[ (C ? C : 1u) * L ], reciprocal[ L ];
+
+            std::copy_n( w + k * N * L, N * L, wk );
+            std::copy_n( x + k * C * L, C * L, xk );
+            for ( std::size_t  l = 0u ; l < L ; ++l )
+                reciprocal[ l ] = T( 1 ) / wk[ k * L + l ];
+            for ( auto  r = k + 1u ; r < N ; ++r )
+            {
+                T * const  wr = w + r * N * L;
+                T * const  xr = x + r * C * L;
+                T          factor[ L ];
+
+                for ( std::size_t  l = 0u ; l < L ; ++l )
+                    factor[ l ] = wr[ k * L + l ] * reciprocal[ l ];
+                for ( auto  c = k + 1u ; c < N ; ++c )
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        wr[ c * L + l ] -= factor[ l ] * wk[ c * L + l ];
+                for ( std::size_t  c = 0u ; c < C ; ++c )
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        xr[ c * L + l ] -= factor[ l ] * xk[ c * L + l ];
+            }
+        }
+    }
+
+    //! Back substitution on a group reduced by #lu_group.
+    template < typename T, std::size_t N, std::size_t C, std::size_t L >
+    void  back_substitute_group( T const *w, T *x )
+    {
+        for ( auto  r = N ; r-- ; )
+            for ( std::size_t  c = 0u ; c < C ; ++c )
+            {
+                T * const  xr = x + ( r * C + c ) * L;
+                T          sum[ L ];
+
+                std::copy_n( xr, L, sum );
+                for ( auto  j = r + 1u ; j < N ; ++j )
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        sum[ l ] -= w[ (r * N + j) * L + l ] * x[ (j * C + c) *
+                         L + l ];
+                for ( std::size_t  l = 0u ; l < L ; ++l )
+                    xr[ l ] = sum[ l ] / w[ (r * N + r) * L + l ];
+            }
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Batched linear algebra function template definitions  --------------------//
+
+/** \brief  Multiply matrices pairwise, into an existing batch.
+    \param a        The left factors.
+    \param b        The right factors.
+    \param result   The products.  It may be `a` or `b` when they're square.
+    \param threads  The maximum number of threads to use.  If zero (the
+                    default), uses the number of hardware threads for large
+                    batches and one thread for small ones.
+    \throws std::invalid_argument  if the three batch sizes aren't equal.
+    \throws Whatever  thread creation throws.
+    \post  `result.get(i)` is `a.get(i) * b.get(i)`.
+ */
+template < typename T, std::size_t R, std::size_t K, std::size_t C,
+ std::size_t L >
+void  multiply( batched_matrix<T, R, K, L> const &a, batched_matrix<T, K, C, L>
+ const &b, batched_matrix<T, R, C, L> &result, unsigned threads = 0u )
+{
+    if ( a.size() != b.size() || a.size() != result.size() )
+        throw std::invalid_argument{ "Batch sizes differ" };
+
+    detail::for_each_group( a.group_count(), R * K * C * L, threads, [&](
+     std::size_t g ){
+        T const * const  x = a.group_data( g );
+        T const * const  y = b.group_data( g );
+        T                z[ R * C * L ];
+
+        for ( std::size_t  r = 0u ; r < R ; ++r )
+            for ( std::size_t  c = 0u ; c < C ; ++c )
+            {
+                T * const  sum = z + ( r * C + c ) * L;
+
+                std::fill_n( sum, L, T() );
+                for ( std::size_t  k = 0u ; k < K ; ++k )
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        sum[ l ] += x[ (r * K + k) * L + l ] * y[ (k * C + c) *
+                         L + l ];
+            }
+        std::copy( z, z + R * C * L, result.group_data(g) );
+    } );
+}
+
+/** \brief  Multiply matrices pairwise.
+    \details  Calls the version taking the result batch.
+    \param a        The left factors.
+    \param b        The right factors.
+    \param threads  The maximum number of threads to use, as in that version.
+    \throws std::invalid_argument  if `a.size() != b.size()`.
+    \throws Whatever  memory allocation or thread creation throws.
+    \returns  A batch whose matrix `i` is `a.get(i) * b.get(i)`.
+ */
+template < typename T, std::size_t R, std::size_t K, std::size_t C,
+ std::size_t L >
+batched_matrix<T, R, C, L>  multiply( batched_matrix<T, R, K, L> const &a,
+ batched_matrix<T, K, C, L> const &b, unsigned threads = 0u )
+{
+    batched_matrix<T, R, C, L>  result( a.size() );
+
+    multiply( a, b, result, threads );
+    return result;
+}
+
+/** \brief  Find the determinants of square matrices, into an existing vector.
+    \details  Uses LU decomposition with partial pivoting.
+    \pre  `T` is a floating-point type.
+    \param a        The matrices.
+    \param result   The determinants.  Resized to `a.size()`.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws Whatever  memory allocation or thread creation throws.
+    \post  `result[i]` is the determinant of `a.get(i)`.
+ */
+template < typename T, std::size_t N, std::size_t L >
+void  determinant( batched_matrix<T, N, N, L> const &a, std::vector<T> &result,
+ unsigned threads = 0u )
+{
+    static_assert( std::is_floating_point<T>::value, "Only floating-point "
+     "elements are supported" );
+
+    result.resize( a.size() );
+    detail::for_each_group( a.group_count(), N * N * N * L, threads, [&](
+     std::size_t g ){
+        T  w[ N * N * L ], sign[ L ];
+
+        detail::load_square_group<T, N, L>( a.group_data(g), w, std::min(L,
+         a.size() - g * L) );
+        detail::lu_group<T, N, 0u, L>( w, nullptr, sign );
+        for ( std::size_t  k = 0u ; k < N ; ++k )
+            for ( std::size_t  l = 0u ; l < L ; ++l )
+                sign[ l ] *= w[ (k * N + k) * L + l ];
+        std::copy_n( sign, std::min(L, a.size() - g * L), result.begin() + g *
+         L );
+    } );
+}
+
+/** \brief  Find the determinants of square matrices.
+    \details  Calls the version taking the result vector.
+    \param a        The matrices.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws Whatever  memory allocation or thread creation throws.
+    \returns  The determinant of each matrix, in order.
+ */
+template < typename T, std::size_t N, std::size_t L >
+std::vector<T>  determinant( batched_matrix<T, N, N, L> const &a, unsigned
+ threads = 0u )
+{
+    std::vector<T>  result;
+
+    determinant( a, result, threads );
+    return result;
+}
+
+/** \brief  Solve square linear systems, into an existing batch.
+    \details  Uses LU decomposition with partial pivoting.
+    \pre  `T` is a floating-point type.
+    \param a        The coefficient matrices.
+    \param b        The right-hand sides, as columns.
+    \param result   The solutions.  It may be `b`.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws std::invalid_argument  if the three batch sizes aren't equal.
+    \throws Whatever  thread creation throws.
+    \post  `a.get(i) * result.get(i)` is `b.get(i)`.  Solutions for singular
+           matrices aren't finite.
+ */
+template < typename T, std::size_t N, std::size_t C, std::size_t L >
+void  lu_solve( batched_matrix<T, N, N, L> const &a, batched_matrix<T, N, C, L>
+ const &b, batched_matrix<T, N, C, L> &result, unsigned threads = 0u )
+{
+    static_assert( std::is_floating_point<T>::value, "Only floating-point "
+     "elements are supported" );
+
+    if ( a.size() != b.size() || a.size() != result.size() )
+        throw std::invalid_argument{ "Batch sizes differ" };
+
+    detail::for_each_group( a.group_count(), N * N * (N + C) * L, threads, [&](
+     std::size_t g ){
+        T  w[ N * N * L ], x[ N * C * L ], sign[ L ];
+
+        detail::load_square_group<T, N, L>( a.group_data(g), w, std::min(L,
+         a.size() - g * L) );
+        std::copy( b.group_data(g), b.group_data(g) + N * C * L, x );
+        detail::lu_group<T, N, C, L>( w, x, sign );
+        detail::back_substitute_group<T, N, C, L>( w, x );
+        std::copy( x, x + N * C * L, result.group_data(g) );
+    } );
+}
+
+/** \brief  Solve square linear systems.
+    \details  Calls the version taking the result batch.
+    \param a        The coefficient matrices.
+    \param b        The right-hand sides, as columns.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws std::invalid_argument  if `a.size() != b.size()`.
+    \throws Whatever  memory allocation or thread creation throws.
+    \returns  A batch whose matrix `i` is `X` such that `a.get(i) * X` is
+              `b.get(i)`.  Solutions for singular matrices aren't finite.
+ */
+template < typename T, std::size_t N, std::size_t C, std::size_t L >
+batched_matrix<T, N, C, L>  lu_solve( batched_matrix<T, N, N, L> const &a,
+ batched_matrix<T, N, C, L> const &b, unsigned threads = 0u )
+{
+    batched_matrix<T, N, C, L>  result( b.size() );
+
+    lu_solve( a, b, result, threads );
+    return result;
+}
+
+/** \brief  Invert square matrices, into an existing batch.
+    \details  Solves against identity matrices with #lu_solve's method.
+    \pre  `T` is a floating-point type.
+    \param a        The matrices.
+    \param result   The inverses.  It may be `a`.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws std::invalid_argument  if `a.size() != result.size()`.
+    \throws Whatever  thread creation throws.
+    \post  `result.get(i)` is the inverse of `a.get(i)`.  Inverses of singular
+           matrices aren't finite.
+ */
+template < typename T, std::size_t N, std::size_t L >
+void  inverse( batched_matrix<T, N, N, L> const &a, batched_matrix<T, N, N, L>
+ &result, unsigned threads = 0u )
+{
+    static_assert( std::is_floating_point<T>::value, "Only floating-point "
+     "elements are supported" );
+
+    if ( a.size() != result.size() )
+        throw std::invalid_argument{ "Batch sizes differ" };
+
+    detail::for_each_group( a.group_count(), 2u * N * N * N * L, threads, [&](
+     std::size_t g ){
+        T           w[ N * N * L ], x[ N * N * L ] = {}, sign[ L ];
+        auto const  live = std::min( L, a.size() - g * L );
+
+        detail::load_square_group<T, N, L>( a.group_data(g), w, live );
+        for ( std::size_t  k = 0u ; k < N ; ++k )
+            std::fill_n( x + (k * N + k) * L, L, T(1) );
+        detail::lu_group<T, N, N, L>( w, x, sign );
+        detail::back_substitute_group<T, N, N, L>( w, x );
+        detail::clear_padding<T, N * N, L>( x, live );
+        std::copy( x, x + N * N * L, result.group_data(g) );
+    } );
+}
+
+/** \brief  Invert square matrices.
+    \details  Calls the version taking the result batch.
+    \param a        The matrices.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws Whatever  memory allocation or thread creation throws.
+    \returns  A batch of the inverses.  Inverses of singular matrices aren't
+              finite.
+ */
+template < typename T, std::size_t N, std::size_t L >
+batched_matrix<T, N, N, L>  inverse( batched_matrix<T, N, N, L> const &a,
+ unsigned threads = 0u )
+{
+    batched_matrix<T, N, N, L>  result( a.size() );
+
+    inverse( a, result, threads );
+    return result;
+}
+
+/** \brief  Factor symmetric positive-definite matrices, into an existing
+            batch.
+    \details  Only the lower triangle of each matrix is read.
+    \pre  `T` is a floating-point type.
+    \param a        The matrices.
+    \param result   The factors.  It may be `a`.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws std::invalid_argument  if `a.size() != result.size()`.
+    \throws Whatever  thread creation throws.
+    \post  `result.get(i)` is the lower-triangular `L` with `L * transpose(L)`
+           equal to `a.get(i)`.  Factors of matrices that aren't
+           positive-definite aren't finite.
+ */
+template < typename T, std::size_t N, std::size_t L >
+void  cholesky( batched_matrix<T, N, N, L> const &a, batched_matrix<T, N, N, L>
+ &result, unsigned threads = 0u )
+{
+    using std::sqrt;
+
+    static_assert( std::is_floating_point<T>::value, "Only floating-point "
+     "elements are supported" );
+
+    if ( a.size() != result.size() )
+        throw std::invalid_argument{ "Batch sizes differ" };
+
+    detail::for_each_group( a.group_count(), N * N * N * L, threads, [&](
+     std::size_t g ){
+        T           y[ N * N * L ];
+        auto const  live = std::min( L, a.size() - g * L );
+
+        // Each element of the lower triangle is replaced by its factor.
+        detail::load_square_group<T, N, L>( a.group_data(g), y, live );
+        for ( std::size_t  j = 0u ; j < N ; ++j )
+            for ( auto  i = j ; i < N ; ++i )
+            {
+                T * const  sum = y + ( i * N + j ) * L;
+
+                for ( std::size_t  k = 0u ; k < j ; ++k )
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        sum[ l ] -= y[ (i * N + k) * L + l ] * y[ (j * N + k) *
+                         L + l ];
+                if ( i == j )
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        sum[ l ] = sqrt( sum[l] );
+                else
+                    for ( std::size_t  l = 0u ; l < L ; ++l )
+                        sum[ l ] /= y[ (j * N + j) * L + l ];
+            }
+        for ( std::size_t  i = 0u ; i < N ; ++i )
+            std::fill( y + (i * N + i + 1u) * L, y + (i + 1u) * N * L, T() );
+        detail::clear_padding<T, N * N, L>( y, live );
+        std::copy( y, y + N * N * L, result.group_data(g) );
+    } );
+}
+
+/** \brief  Factor symmetric positive-definite matrices.
+    \details  Calls the version taking the result batch.
+    \param a        The matrices.
+    \param threads  The maximum number of threads to use, as in #multiply.
+    \throws Whatever  memory allocation or thread creation throws.
+    \returns  A batch of the lower-triangular `L` with `L * transpose(L)` equal
+              to the corresponding matrix.  Factors of matrices that aren't
+              positive-definite aren't finite.
+ */
+template < typename T, std::size_t N, std::size_t L >
+batched_matrix<T, N, N, L>  cholesky( batched_matrix<T, N, N, L> const &a,
+ unsigned threads = 0u )
+{
+    batched_matrix<T, N, N, L>  result( a.size() );
+
+    cholesky( a, result, threads );
+    return result;
+}
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_BATCHED_MATRIX_HPP
@@ -0,0 +1,604 @@
+//  Boost Bit-Packed Multi-dimensional Array header file  --------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  Class templates for multi-dimensional arrays of Boolean flags,
+      stored one bit per element.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a container packing `bool`
+    elements into 64-bit words, with proxy references, and of a `multiarray`
+    using that container as a mask.  Filling, counting, testing, and the
+    bitwise operations between masks work a word at a time, and the set
+    elements can be visited without looking at every clear one.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_BIT_MULTIARRAY_HPP
+#define BOOST_CONTAINER_BIT_MULTIARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! The storage unit for packed flags.
+    typedef std::uint64_t  bit_word;
+
+    //! The number of flags per storage unit.
+    constexpr std::size_t  bit_word_size = 64u;
+
+    //! The number of set bits in a word.
+    inline
+    std::size_t  popcount( bit_word x ) noexcept
+    {
+#if defined(__GNUC__)
+        return static_cast<std::size_t>( __builtin_popcountll(x) );
+#else
+        x -= ( x >> 1 ) & 0x5555555555555555u;
+        x = ( x & 0x3333333333333333u ) + ( (x >> 2) & 0x3333333333333333u );
+        x = ( x + (x >> 4) ) & 0x0F0F0F0F0F0F0F0Fu;
+        return static_cast<std::size_t>( (x * 0x0101010101010101u) >> 56 );
+#endif
+    }
+
+    //! The position of the lowest set bit in a non-zero word.
+    inline
+    std::size_t  lowest_set_bit( bit_word x ) noexcept
+    {
+#if defined(__GNUC__)
+        return static_cast<std::size_t>( __builtin_ctzll(x) );
+#else
+        return popcount( (x & -x) - 1u );
+#endif
+    }
+
+    //! Mutable reference to a single packed flag.
+    class bit_reference
+    {
+    public:
+        bit_reference( bit_word *w, bit_word m ) noexcept
+          : word( w ), mask( m )
+        {}
+
+        operator bool() const noexcept  { return *word & mask; }
+        bit_reference &  operator =( bool v ) noexcept
+        { if ( v ) *word |= mask; else *word &= ~mask; return *this; }
+        bit_reference &  operator =( bit_reference const &o ) noexcept
+        { return *this = static_cast<bool>( o ); }
+
+        //! Toggle the flag.
+        void  flip() noexcept  { *word ^= mask; }
+
+        // Proxies are usually temporaries, so swapping takes them by value.
+        friend  void  swap( bit_reference a, bit_reference b ) noexcept
+        { bool const  t = a; a = static_cast<bool>( b ); b = t; }
+
+    private:
+        bit_word *  word;
+        bit_word    mask;
+    };
+
+    //! Random-access iterator over packed flags.
+    template < bool IsConst >
+    class bit_iterator
+    {
+        typedef typename std::conditional<IsConst, bit_word const, bit_word
+         >::type  word_type;
+
+    public:
+        typedef std::random_access_iterator_tag  iterator_category;
+        typedef bool                                     value_type;
+        typedef std::ptrdiff_t                      difference_type;
+        typedef void                                        pointer;
+        typedef typename std::conditional<IsConst, bool, bit_reference
+         >::type                                          reference;
+
+        bit_iterator() noexcept  : words( nullptr ), i( 0u )  {}
+        bit_iterator( word_type *w, std::size_t at ) noexcept
+          : words( w ), i( at )
+        {}
+        //! Mutable iterators convert to immutable ones.
+        template < bool B, typename = typename std::enable_if<IsConst &&
+         !B>::type >
+        bit_iterator( bit_iterator<B> const &o ) noexcept
+          : words( o.words ), i( o.i )
+        {}
+
+        reference  operator *() const
+        { return deref( std::integral_constant<bool, IsConst>{} ); }
+        reference  operator []( difference_type n ) const
+        { return *(*this + n); }
+
+        bit_iterator &  operator ++() noexcept  { ++i; return *this; }
+        bit_iterator &  operator --() noexcept  { --i; return *this; }
+        bit_iterator  operator ++( int ) noexcept
+        { auto  t = *this; ++i; return t; }
+        bit_iterator  operator --( int ) noexcept
+        { auto  t = *this; --i; return t; }
+        bit_iterator &  operator +=( difference_type n ) noexcept
+        { i += n; return *this; }
+        bit_iterator &  operator -=( difference_type n ) noexcept
+        { i -= n; return *this; }
+
+        friend  bit_iterator  operator +( bit_iterator b, difference_type n )
+         noexcept  { return b += n; }
+        friend  bit_iterator  operator +( difference_type n, bit_iterator b )
+         noexcept  { return b += n; }
+        friend  bit_iterator  operator -( bit_iterator b, difference_type n )
+         noexcept  { return b -= n; }
+        friend  difference_type  operator -( bit_iterator const &l,
+         bit_iterator const &r ) noexcept
+        { return static_cast<difference_type>( l.i - r.i ); }
+
+        friend  bool  operator ==( bit_iterator const &l, bit_iterator const &r
+         ) noexcept  { return l.i == r.i; }
+        friend  bool  operator !=( bit_iterator const &l, bit_iterator const &r
+         ) noexcept  { return l.i != r.i; }
+        friend  bool  operator <( bit_iterator const &l, bit_iterator const &r )
+         noexcept  { return l.i < r.i; }
+        friend  bool  operator >( bit_iterator const &l, bit_iterator const &r )
+         noexcept  { return l.i > r.i; }
+        friend  bool  operator <=( bit_iterator const &l, bit_iterator const &r
+         ) noexcept  { return l.i <= r.i; }
+        friend  bool  operator >=( bit_iterator const &l, bit_iterator const &r
+         ) noexcept  { return l.i >= r.i; }
+
+    private:
+        template < bool B >  friend class bit_iterator;
+
+        bool           deref( std::true_type ) const
+        { return words[ i / bit_word_size ] >> i % bit_word_size & 1u; }
+        bit_reference  deref( std::false_type ) const
+        {
+            return bit_reference( words + i / bit_word_size, bit_word(1u) << i
+             % bit_word_size );
+        }
+
+        word_type *  words;
+        std::size_t  i;
+    };
+
+    //! Forward iterator over the index coordinates of the set flags.
+    template < typename SizeType, std::size_t Rank >
+    class set_bit_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag        iterator_category;
+        typedef std::array<SizeType, Rank>              value_type;
+        typedef std::ptrdiff_t                     difference_type;
+        typedef value_type const *                         pointer;
+        typedef value_type const &                       reference;
+
+        //! Past-the-end iterator for `n` words.
+        explicit  set_bit_iterator( std::size_t n = 0u ) noexcept
+          : words( nullptr ), count( n ), k( n ), bits( 0u ), extents(),
+            strides(), index()
+        {}
+        //! Iterator to the first set flag of `n` words.
+        set_bit_iterator( bit_word const *w, std::size_t n, value_type const &e,
+         value_type const &s ) noexcept
+          : words( w ), count( n ), k( 0u ), bits( n ? *w : 0u ), extents( e ),
+            strides( s ), index()
+        { settle(); }
+
+        reference  operator *() const noexcept  { return index; }
+        pointer   operator ->() const noexcept  { return &index; }
+
+        set_bit_iterator &  operator ++() noexcept
+        { bits &= bits - 1u; settle(); return *this; }
+        set_bit_iterator  operator ++( int ) noexcept
+        { auto  t = *this; ++*this; return t; }
+
+        friend  bool  operator ==( set_bit_iterator const &l, set_bit_iterator
+         const &r ) noexcept  { return l.k == r.k && l.bits == r.bits; }
+        friend  bool  operator !=( set_bit_iterator const &l, set_bit_iterator
+         const &r ) noexcept  { return !( l == r ); }
+
+    private:
+        // Skip clear words, then decode the lowest remaining set bit.
+        void  settle() noexcept
+        {
+            while ( !bits && k + 1u < count )
+                bits = words[ ++k ];
+            if ( !bits )
+            {
+                k = count;
+                return;
+            }
+
+            auto const  offset = static_cast<SizeType>( k * bit_word_size +
+             lowest_set_bit(bits) );
+
+            for ( std::size_t  a = 0u ; a < Rank ; ++a )
+                index[ a ] = offset / strides[ a ] % extents[ a ];
+        }
+
+        bit_word const *  words;
+        std::size_t       count, k;
+        bit_word          bits;
+        value_type        extents, strides, index;
+    };
+
+    //! The set flags of a mask, as a range.
+    template < typename SizeType, std::size_t Rank >
+    struct set_bit_range
+    {
+        typedef set_bit_iterator<SizeType, Rank>  iterator;
+
+        iterator  begin() const noexcept  { return first; }
+        iterator    end() const noexcept  { return last; }
+
+        iterator  first, last;
+    };
+
+}  // namespace detail
+//! \endcond
+
+
+//  Packed Boolean vector class definition  ----------------------------------//
+
+/** \brief  A container of `bool` that stores one bit per element.
+
+Elements are packed 64 to a word, with element *i* in bit `i % 64` of word `i
+/ 64`.  Mutable access goes through a proxy reference, like
+`std::vector<bool>`, but the proxy and iterator types are simple enough for
+the compiler to see through.  The operations that work on every element go a
+word at a time.
+
+The unused bits of the last word are always clear, so whole words can be
+counted and compared.
+
+    \see  #bit_multiarray
+ */
+class packed_bool_vector
+{
+public:
+    // Container types
+    typedef bool                                  value_type;
+    typedef detail::bit_reference                  reference;
+    typedef bool                             const_reference;
+    typedef detail::bit_iterator<false>             iterator;
+    typedef detail::bit_iterator<true>        const_iterator;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                   difference_type;
+    //! The storage unit for elements.
+    typedef detail::bit_word                       word_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    //! Default constructor; no elements.
+    packed_bool_vector() noexcept  : bits( 0u )  {}
+    //! Create `n` copies of `v`.
+    explicit  packed_bool_vector( size_type n, bool v = false )
+      : words( words_for(n), v ? ~word_type(0u) : word_type(0u) ), bits( n )
+    { trim(); }
+
+    // Container interface
+    //! \returns  An iterator to the first element.
+          iterator   begin()  { return iterator( words.data(), 0u ); }
+    //! \overload
+    const_iterator   begin() const
+    { return const_iterator( words.data(), 0u ); }
+    //! \returns  An iterator past the last element.
+          iterator     end()  { return iterator( words.data(), bits ); }
+    //! \overload
+    const_iterator     end() const
+    { return const_iterator( words.data(), bits ); }
+    //! \returns  `begin() const`.
+    const_iterator  cbegin() const  { return begin(); }
+    //! \returns  `end() const`.
+    const_iterator    cend() const  { return end(); }
+
+    //! \returns  The number of elements.
+    size_type  size() const noexcept  { return bits; }
+    //! \returns  `size() == 0`.
+    bool      empty() const noexcept  { return !bits; }
+
+    //! Exchange elements with another object.
+    void  swap( packed_bool_vector &other ) noexcept
+    { words.swap(other.words); std::swap(bits, other.bits); }
+
+    // Word access
+    //! \returns  The number of storage words.
+    size_type          word_count() const noexcept  { return words.size(); }
+    //! \returns  The address of the storage words.  The unused bits of the last
+    //!           word must be left clear.
+    word_type *        word_data() noexcept  { return words.data(); }
+    //! \overload
+    word_type const *  word_data() const noexcept  { return words.data(); }
+
+    // Whole-container operations
+    //! Set every element to `v`.
+    void  fill( bool v ) noexcept
+    {
+        std::fill( words.begin(), words.end(), v ? ~word_type(0u) :
+         word_type(0u) );
+        trim();
+    }
+    //! Toggle every element.
+    void  flip() noexcept  { for ( auto &w : words ) w = ~w; trim(); }
+
+    //! \returns  The number of set elements.
+    size_type  count() const noexcept
+    {
+        size_type  result = 0u;
+
+        for ( auto const  w : words )
+            result += detail::popcount( w );
+        return result;
+    }
+    //! \returns  Whether any element is set.
+    bool  any() const noexcept
+    {
+        return std::any_of( words.begin(), words.end(), [](word_type w){
+         return w != 0u; } );
+    }
+    //! \returns  Whether every element is set.  (True when empty.)
+    bool  all() const noexcept
+    {
+        auto const  full = bits / detail::bit_word_size;
+
+        return std::all_of( words.begin(), words.begin() + full, [](word_type
+         w){ return !~w; } ) && ( full == words.size() || words.back() ==
+         last_mask() );
+    }
+
+    /** \brief  Element-wise AND, OR, or XOR with another container.
+        \pre  `other.size() == size()`.
+        \param other  The other operand.
+        \returns  `*this`.
+     */
+    packed_bool_vector &  operator &=( packed_bool_vector const &other )
+     noexcept
+    {
+        for ( size_type  i = 0u ; i < words.size() ; ++i )
+            words[ i ] &= other.words[ i ];
+        return *this;
+    }
+    //! \overload
+    packed_bool_vector &  operator |=( packed_bool_vector const &other )
+     noexcept
+    {
+        for ( size_type  i = 0u ; i < words.size() ; ++i )
+            words[ i ] |= other.words[ i ];
+        return *this;
+    }
+    //! \overload
+    packed_bool_vector &  operator ^=( packed_bool_vector const &other )
+     noexcept
+    {
+        for ( size_type  i = 0u ; i < words.size() ; ++i )
+            words[ i ] ^= other.words[ i ];
+        return *this;
+    }
+
+    //! \returns  Whether both containers have the same elements.
+    friend  bool  operator ==( packed_bool_vector const &l, packed_bool_vector
+     const &r ) noexcept
+    { return l.bits == r.bits && l.words == r.words; }
+    //! \returns  `!( l == r )`.
+    friend  bool  operator !=( packed_bool_vector const &l, packed_bool_vector
+     const &r ) noexcept
+    { return !( l == r ); }
+
+private:
+    static  size_type  words_for( size_type n ) noexcept
+    { return n / detail::bit_word_size + !!( n % detail::bit_word_size ); }
+
+    // The used bits of the last word.
+    word_type  last_mask() const noexcept
+    {
+        return bits % detail::bit_word_size ? ( word_type(1u) << bits %
+         detail::bit_word_size ) - 1u : ~word_type( 0u );
+    }
+    // Keep the unused bits clear.
+    void  trim() noexcept
+    { if ( !words.empty() ) words.back() &= last_mask(); }
+
+    std::vector<word_type>  words;
+    size_type               bits;
+};
+
+//! Swap routine for `packed_bool_vector`.
+inline
+void  swap( packed_bool_vector &a, packed_bool_vector &b ) noexcept
+{ a.swap(b); }
+
+
+//  Bit-packed multi-dimensional array class template definition  ------------//
+
+/** \brief  A `multiarray` of flags, packed one per bit, usable as a mask.
+
+This class template provides the #multiarray interface over a
+#packed_bool_vector, and adds operations that go a word at a time: #fill,
+#count, #any, #all, #none, #flip, and bitwise AND, OR, and XOR between masks of
+the same shape.  Mutable element access returns a proxy; functions given to
+`apply` should take the element by value (or as `auto`), not as `bool &`.
+
+#set_bits gives the index coordinates of the set elements, skipping 64 clear
+elements at a time.
+
+    \pre  `size() == required_size()`, as set up by the constructors.  (Masks
+          can be re-shaped with `extents`, as long as the product of the
+          extents stays the same.)
+
+    \tparam Rank  The number of index coordinates to access an element.
+ */
+template < std::size_t Rank >
+class bit_multiarray
+    : public multiarray<bool, Rank, packed_bool_vector>
+{
+    // Base type
+    using base_type = multiarray<bool, Rank, packed_bool_vector>;
+
+public:
+    // Other types
+    using typename base_type::container_type;
+    using typename base_type::size_type;
+    using typename base_type::stats_type;
+    //! The range type returned by #set_bits.
+    typedef detail::set_bit_range<size_type, Rank>  set_bit_range;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Create a mask of the given shape, in row-major order.
+        \param e  The extents.
+        \param v  The value of every element.
+        \throws Whatever  #multiarray::extents throws, or memory allocation.
+        \post  `extents() == e && size() == required_size()`.
+     */
+    bit_multiarray( stats_type const &e, bool v )
+    { this->extents( e ); c = container_type( this->required_size(), v ); }
+    /** \brief  Pack an array of `bool`, keeping its shape.
+        \param a  The array to pack.
+        \throws Whatever  memory allocation throws.
+        \post  `(*this)( i... ) == a( i... )` for every index.
+     */
+    template < std::size_t ...N >
+    explicit  bit_multiarray( array_md<bool, N...> const &a )
+    {
+        static_assert( sizeof...(N) == Rank, "Rank mismatch" );
+
+        this->extents( stats_type{{ N... }} );
+        c = container_type( a.size() );
+        std::copy( a.data(), a.data() + a.size(), c.begin() );
+    }
+
+    // Whole-mask operations
+    //! Set every element to `v`, a word at a time.
+    void  fill( bool v ) noexcept  { c.fill(v); }
+    //! Toggle every element.  \returns  `*this`.
+    bit_multiarray &  flip() noexcept  { c.flip(); return *this; }
+
+    //! \returns  The number of set elements.
+    size_type  count() const noexcept  { return c.count(); }
+    //! \returns  Whether any element is set.
+    bool         any() const noexcept  { return c.any(); }
+    //! \returns  Whether every element is set.
+    bool         all() const noexcept  { return c.all(); }
+    //! \returns  Whether no element is set.
+    bool        none() const noexcept  { return !c.any(); }
+
+    /** \brief  Element-wise AND, OR, or XOR with another mask.
+        \param other  The other operand.
+        \throws std::invalid_argument  if the masks have different extents or
+                  priorities.
+        \returns  `*this`.
+     */
+    bit_multiarray &  operator &=( bit_multiarray const &other )
+    { check_shape(other); c &= other.c; return *this; }
+    //! \overload
+    bit_multiarray &  operator |=( bit_multiarray const &other )
+    { check_shape(other); c |= other.c; return *this; }
+    //! \overload
+    bit_multiarray &  operator ^=( bit_multiarray const &other )
+    { check_shape(other); c ^= other.c; return *this; }
+
+    /** \brief  The index coordinates of the set elements.
+
+    Iterating the range gives a `stats_type` for each set element, in memory
+    order.  Clear elements are skipped a word at a time, so the cost follows
+    the number of set elements more than the size of the mask.  The range is
+    invalidated by any change to the mask.
+
+        \returns  A range usable in a range-based `for`.
+     */
+    set_bit_range  set_bits() const
+    {
+        return set_bit_range{ typename set_bit_range::iterator( c.word_data(),
+         c.word_count(), this->extents(), this->strides() ), typename
+         set_bit_range::iterator( c.word_count() ) };
+    }
+
+protected:
+    using base_type::c;
+
+private:
+    void  check_shape( bit_multiarray const &other ) const
+    {
+        if ( this->extents() != other.extents() || this->priorities() !=
+         other.priorities() )
+            throw std::invalid_argument{ "Masks have different shapes" };
+    }
+};
+
+/** \brief  Element-wise AND, OR, or XOR of two masks.
+    \param a  The first operand.
+    \param b  The second operand.
+    \throws std::invalid_argument  if the masks have different extents or
+              priorities.
+    \returns  A mask with the combined elements.
+ */
+template < std::size_t Rank >
+inline
+bit_multiarray<Rank>  operator &( bit_multiarray<Rank> a, bit_multiarray<Rank>
+ const &b )
+{ return a &= b; }
+//! \overload
+template < std::size_t Rank >
+inline
+bit_multiarray<Rank>  operator |( bit_multiarray<Rank> a, bit_multiarray<Rank>
+ const &b )
+{ return a |= b; }
+//! \overload
+template < std::size_t Rank >
+inline
+bit_multiarray<Rank>  operator ^( bit_multiarray<Rank> a, bit_multiarray<Rank>
+ const &b )
+{ return a ^= b; }
+/** \brief  Element-wise NOT of a mask.
+    \param a  The operand.
+    \returns  A mask with every element of `a` toggled.
+ */
+template < std::size_t Rank >
+inline
+bit_multiarray<Rank>  operator ~( bit_multiarray<Rank> a )
+{ return a.flip(); }
+
+/** \brief  Swap routine for `bit_multiarray`.
+    \param a  The first object to have its state exchanged.
+    \param b  The second object to have its state exchanged.
+ */
+template < std::size_t Rank >
+inline
+void  swap( bit_multiarray<Rank> &a, bit_multiarray<Rank> &b )
+{ a.swap(b); }
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_BIT_MULTIARRAY_HPP
@@ -0,0 +1,175 @@
+//  Boost Copy-on-Write Vector header file  ----------------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template for a sequence container whose copies share their
+      elements until one of them is changed.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a contiguous container class
+    template whose copies share a reference-counted element block.  Mutable
+    element access makes the block unique first (copy-on-write).  It provides
+    enough of the container interface to be used as the storage of a
+    `multiarray`, so arrays passed by value cost a counter increment until they
+    are written.  An alias template names that combination.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_COW_VECTOR_HPP
+#define BOOST_CONTAINER_COW_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "boost/container/multiarray.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Copy-on-write vector class template definition  --------------------------//
+
+/** \brief  A contiguous container whose copies share elements until written.
+
+Copying a `cow_vector` shares the original's element block and bumps a
+reference count.  The first mutable access to the elements of a shared block
+(a non-`const` call of #begin, #end, or #data) gives the object its own copy of
+the block; this is the only time elements are copied.  Immutable access never
+copies.
+
+As with any copy-on-write type, a reference or iterator from a mutable access
+must not be used to write after the object has been copied again, since the
+block may be shared by then.  Get a fresh one after copying.  Sharing is
+thread-safe between objects (the count is atomic), but each object is not.
+
+    \tparam T  The element type.
+ */
+template < typename T >
+class cow_vector
+{
+    typedef std::vector<T>  block_type;
+
+public:
+    // Container types
+    typedef T                                  value_type;
+    typedef T &                                 reference;
+    typedef T const &                     const_reference;
+    typedef T *                                   pointer;
+    typedef T const *                       const_pointer;
+    typedef pointer                              iterator;
+    typedef const_pointer                  const_iterator;
+    typedef typename block_type::size_type      size_type;
+    typedef std::ptrdiff_t                difference_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    //! Default constructor.  No block is allocated.
+    cow_vector() noexcept  = default;
+    //! Create `n` value-initialized elements.
+    explicit  cow_vector( size_type n )
+      : block( std::make_shared<block_type>(n) )
+    {}
+    //! Create `n` copies of `v`.
+    cow_vector( size_type n, T const &v )
+      : block( std::make_shared<block_type>(n, v) )
+    {}
+    //! Create from a list of elements.
+    cow_vector( std::initializer_list<T> i )
+      : block( std::make_shared<block_type>(i) )
+    {}
+    //! Take the elements of a `std::vector`.
+    explicit  cow_vector( block_type v )
+      : block( std::make_shared<block_type>(std::move( v )) )
+    {}
+
+    // Container interface
+    //! \returns  An iterator to the first element.  Unshares the block.
+          iterator   begin()        { return data(); }
+    //! \returns  An iterator to the first element.  Never copies.
+    const_iterator   begin() const  { return data(); }
+    //! \returns  An iterator past the last element.  Unshares the block.
+          iterator     end()        { return data() + size(); }
+    //! \returns  An iterator past the last element.  Never copies.
+    const_iterator     end() const  { return data() + size(); }
+    //! \returns  `begin() const`.
+    const_iterator  cbegin() const  { return begin(); }
+    //! \returns  `end() const`.
+    const_iterator    cend() const  { return end(); }
+
+    /** \returns  The address of the element block, or `nullptr` if empty.
+        \throws Whatever  copying the block throws, when it was shared.
+        \post  `!shared()`.
+     */
+    pointer          data()
+    { detach(); return block && !block->empty() ? block->data() : nullptr; }
+    //! \returns  The address of the element block, or `nullptr` if empty.
+    const_pointer    data() const
+    { return block && !block->empty() ? block->data() : nullptr; }
+
+    //! \returns  The number of elements.
+    size_type        size() const noexcept  { return block ? block->size(): 0u; }
+    //! \returns  `size() == 0`.
+    bool            empty() const noexcept  { return !size(); }
+
+    //! \returns  Whether another object shares the element block.
+    bool           shared() const noexcept
+    { return block && block.use_count() > 1; }
+
+    //! Exchange blocks with another object.  No elements are copied.
+    void  swap( cow_vector &other ) noexcept  { block.swap(other.block); }
+
+private:
+    // Give this object its own element block, if it's shared.
+    void  detach()
+    {
+        if ( shared() )
+            block = std::make_shared<block_type>( *block );
+    }
+
+    std::shared_ptr<block_type>  block;
+};
+
+//! Swap routine for `cow_vector`.
+template < typename T >
+inline
+void  swap( cow_vector<T> &a, cow_vector<T> &b ) noexcept  { a.swap(b); }
+
+
+//  Copy-on-write multi-dimensional array alias template definition  ---------//
+
+/** \brief  A `multiarray` whose copies share elements until written.
+
+Copying is constant-time.  Mutable element access (`operator ()`, `at`,
+`operator []`, `fill`, mutable `apply`, `begin`, and `data`) copies the
+elements first if they are shared.  Changing the extents or priorities never
+copies elements.
+
+    \tparam T     The element type.
+    \tparam Rank  The number of index coordinates to access an element.
+ */
+template < typename T, std::size_t Rank >
+using cow_multiarray = multiarray<T, Rank, cow_vector<T>>;
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_COW_VECTOR_HPP
@@ -0,0 +1,348 @@
+//  Boost Multi-dimensional Fenwick Tree header file  ------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template that answers sums over boxes of a multi-dimensional
+      array while elements keep changing.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template holding a
+    multi-dimensional Fenwick (or binary indexed) tree.  Changing one element
+    and summing over an axis-aligned box both take time proportional to the
+    product of the logarithms of the extents.  Compare the summed-area table,
+    which sums in constant time but has to redo a whole corner of itself after
+    each change.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_FENWICK_TREE_HPP
+#define BOOST_CONTAINER_FENWICK_TREE_HPP
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+#include "boost/container/multiarray_ref.hpp"
+#include "boost/container/summed_area_table.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Fenwick tree class template definition  ----------------------------------//
+
+/** \brief  A multi-dimensional Fenwick tree, for box sums with point updates.
+
+The tree has the same extents as its source.  Each axis is treated like a
+one-dimensional Fenwick tree: entry `i` covers the `i + 1` rounded down to its
+lowest set bit elements ending at `i`.  An entry of the whole tree covers the
+box made from the ranges for each of its indexes.  So #add touches, and
+#prefix_sum reads, at most `(1 + log2 e0) * ... * (1 + log2 eN)` entries.
+
+Construction from an array takes one pass per axis, split among threads like
+#inclusive_scan_along.
+
+    \pre  `Rank > 0`.
+    \pre  The elements are summable, with subtraction as the inverse of
+          addition, when converted to `Accumulator`.
+
+    \tparam T            The source element type.
+    \tparam Rank         The number of index coordinates to locate an element.
+    \tparam Accumulator  The type of the sums.  If not given, defaults to the
+                         type #summed_area_accumulator chooses.
+ */
+template < typename T, std::size_t Rank, typename Accumulator = typename
+ summed_area_accumulator<T>::type >
+class fenwick_tree
+{
+    static_assert( Rank > 0u, "A Fenwick tree needs at least one axis" );
+
+public:
+    // Template parameters
+    //! The source element type.  Gives access to its template parameter.
+    typedef T                 element_type;
+    //! The sum type.  Gives access to its template parameter.
+    typedef Accumulator        value_type;
+    //! The number of extents.  Gives access to its template parameter.
+    static constexpr  std::size_t  dimensionality = Rank;
+
+    // Other types
+    //! The type of the tree's entries.
+    typedef multiarray<value_type, Rank>      table_type;
+    //! The type for size-based meta-data.
+    typedef typename table_type::size_type     size_type;
+    //! The type for lists of extents and indexes.
+    typedef typename table_type::stats_type   stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Build a tree with every element zero.
+        \param e  The extents.
+        \throws Whatever  #multiarray::extents throws, or memory allocation.
+        \post  `extents() == e`.
+     */
+    explicit  fenwick_tree( stats_type const &e )
+      : tree( std::vector<value_type>(count( e )) )
+    { tree.extents(e); }
+    /** \brief  Build the tree for a source array.
+        \param source   The array to sum.  Its index priorities don't matter.
+        \param threads  The maximum number of threads to use.  If zero (the
+                        default), chosen automatically.
+        \throws std::length_error  if `source.size() <
+                                   source.required_size()`.
+        \throws Whatever  memory allocation throws.
+        \post  `extents() == source.extents()`.
+     */
+    template < class Container, typename IndexType >
+    explicit  fenwick_tree( multiarray<T, Rank, Container, IndexType> const
+     &source, unsigned threads = 0u )
+      : tree( std::vector<value_type>(source.required_size()) )
+    {
+        detail::require_full_size( source );
+        tree.extents( detail::convert_stats<stats_type>(source.extents()) );
+        source.capply( detail::sat_loader<table_type>{tree} );
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+            build_along( d, threads );
+    }
+    //! \overload
+    template < std::size_t ...N >
+    explicit  fenwick_tree( array_md<T, N...> const &source, unsigned threads =
+     0u )
+      : fenwick_tree( make_multiarray_ref(source), threads )
+    { static_assert( sizeof...(N) == Rank, "Wrong number of extents" ); }
+
+    // Observers
+    //! \returns  The extents of the source array.
+    stats_type  extents() const  { return tree.extents(); }
+
+    /** \brief  Sum the source elements before a corner.
+        \pre  `hi[k] <= extents()[k]` for each `k`.
+        \param hi  One past the greatest index coordinates to sum.
+        \returns  The sum of the source elements at `(i0, ..., iN)` for all
+                  `ik < hi[k]`.
+     */
+    value_type  prefix_sum( stats_type const &hi ) const
+    {
+        auto const    s = tree.strides();
+        offset_lists  at;
+
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+        {
+            at.count[ d ] = 0u;
+            for ( auto  i = hi[ d ] ; i ; i &= i - 1u )
+                at.offsets[ d ][ at.count[d]++ ] = ( i - 1u ) * s[ d ];
+        }
+
+        value_type  result = value_type();
+
+        at.for_each( [&]( size_type o ){ result = result + tree.begin()[o]; } );
+        return result;
+    }
+
+    /** \brief  Sum the source elements in a box.
+        \param lo  The least index coordinates in the box.
+        \param hi  One past the greatest index coordinates in the box.
+        \throws std::out_of_range  if `lo[k] > hi[k]` or `hi[k] > extents()[k]`
+                                   for some `k`.
+        \returns  The sum of source elements at `(i0, ..., iN)` for all
+                  `lo[k] <= ik < hi[k]`.  That is zero if the box is empty.
+     */
+    value_type  sum( stats_type const &lo, stats_type const &hi ) const
+    {
+        auto const  e = tree.extents();
+
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+            if ( lo[d] > hi[d] || hi[d] > e[d] )
+                throw std::out_of_range{ "Box outside of tree" };
+
+        // Inclusion-exclusion over the box's corners
+        value_type  result = value_type();
+
+        for ( std::size_t  corner = 0u ; corner < (std::size_t( 1u ) << Rank) ;
+         ++corner )
+        {
+            stats_type  c = hi;
+            bool        negate = false, skip = false;
+
+            for ( size_type  d = 0u ; d < Rank ; ++d )
+                if ( corner >> d & 1u )
+                {
+                    c[ d ] = lo[ d ];
+                    skip = skip || !lo[ d ];
+                    negate = !negate;
+                }
+            if ( skip )
+                continue;
+            if ( negate )
+                result = result - prefix_sum( c );
+            else
+                result = result + prefix_sum( c );
+        }
+        return result;
+    }
+
+    /** \brief  The current value of a source element.
+        \param i  The element's index coordinates.
+        \throws std::out_of_range  if some `i[k] >= extents()[k]`.
+        \returns  `sum( i, i + 1 )`, with 1 added to each coordinate.
+     */
+    value_type  value( stats_type const &i ) const
+    {
+        stats_type  e = i;
+
+        for ( auto &x : e )
+            ++x;
+        return sum( i, e );
+    }
+
+    // Updates
+    /** \brief  Add to a source element.
+        \param i      The element's index coordinates.
+        \param delta  The amount to add.
+        \throws std::out_of_range  if some `i[k] >= extents()[k]`.
+        \post  `value( i )` is increased by `delta`, and so is every sum of a
+               box containing `i`.
+     */
+    void  add( stats_type const &i, value_type const &delta )
+    {
+        auto const    e = tree.extents(), s = tree.strides();
+        offset_lists  at;
+
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+        {
+            if ( i[d] >= e[d] )
+                throw std::out_of_range{ "Index too large" };
+            at.count[ d ] = 0u;
+            for ( auto  j = i[ d ] + 1u ; j <= e[ d ] ; j += j & (~j + 1u) )
+                at.offsets[ d ][ at.count[d]++ ] = ( j - 1u ) * s[ d ];
+        }
+
+        auto const  first = tree.begin();
+
+        at.for_each( [&]( size_type o ){ first[o] = first[o] + delta; } );
+    }
+
+    /** \brief  Replace a source element.
+        \param i  The element's index coordinates.
+        \param v  The new value.
+        \throws std::out_of_range  if some `i[k] >= extents()[k]`.
+        \post  `value( i ) == v`.
+     */
+    void  set( stats_type const &i, value_type const &v )
+    { add(i, v - value( i )); }
+
+private:
+    // Offsets of the entries to visit along each axis; the entries visited
+    // are all the combinations of one offset per axis.
+    struct offset_lists
+    {
+        std::array<std::array<size_type,
+         std::numeric_limits<size_type>::digits>, Rank>  offsets;
+        std::array<size_type, Rank>                     count;
+
+        template < typename Function >
+        void  for_each( Function &&f ) const
+        {
+            for ( auto const  n : count )
+                if ( !n )
+                    return;
+
+            std::array<size_type, Rank>  k{};
+
+            do
+            {
+                size_type  o = 0u;
+
+                for ( size_type  d = 0u ; d < Rank ; ++d )
+                    o += offsets[ d ][ k[d] ];
+                f( o );
+            } while ( next(k) );
+        }
+
+        bool  next( std::array<size_type, Rank> &k ) const
+        {
+            for ( auto  d = Rank ; d-- ; )
+            {
+                if ( ++k[d] < count[d] )
+                    return true;
+                k[ d ] = 0u;
+            }
+            return false;
+        }
+    };
+
+    static  size_type  count( stats_type const &e )
+    {
+        size_type  result = 1u;
+
+        for ( auto const  x : e )
+            result *= x;
+        return result;
+    }
+
+    // The one-dimensional linear-time build, on every line along an axis:
+    // each entry adds itself to the next entry that covers it.
+    void  build_along( size_type axis, unsigned threads )
+    {
+        detail::multiarray_axis_blocks<size_type> const  blocks( tree, axis );
+        auto const                                       first = tree.begin();
+        auto const  slab = blocks.length * blocks.width;
+
+        detail::parallel_chunks( blocks.outer * blocks.width,
+         detail::thread_count_for(tree.required_size(), threads), [&](
+         std::size_t b, std::size_t e ){
+            blocks.for_columns( b, e, [&]( std::size_t o, std::size_t jb,
+             std::size_t je ){
+                auto const  base = first + o * slab;
+
+                for ( size_type  i = 1u ; i <= blocks.length ; ++i )
+                {
+                    auto const  up = i + ( i & (~i + 1u) );
+
+                    if ( up > blocks.length )
+                        continue;
+
+                    auto const  from = base + ( i - 1u ) * blocks.width;
+                    auto const  to = base + ( up - 1u ) * blocks.width;
+
+                    for ( auto  j = jb ; j < je ; ++j )
+                        to[ j ] = to[ j ] + from[ j ];
+                }
+            } );
+        } );
+    }
+
+    table_type  tree;
+};
+
+//! Gives definition to the number of extents.
+template < typename T, std::size_t Rank, typename Accumulator >
+constexpr
+std::size_t  fenwick_tree<T, Rank, Accumulator>::dimensionality;
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_FENWICK_TREE_HPP
@@ -0,0 +1,617 @@
+//  Boost Multi-dimensional Hybrid-Extent Array Adapter header file  ---------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template that is a container adapter class that grants
+      multiple-value indexing, with a mix of fixed and run-time extents.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of class templates modeling a
+    container adapter.  Like `multiarray`, the adaptation grants a sequence
+    container a way to access elements with a given number of indexes.  Unlike
+    `multiarray`, each extent may be fixed at compile time, so the offset
+    arithmetic and loops involving those extents are constant-folded.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_HYBRID_MULTIARRAY_HPP
+#define BOOST_CONTAINER_HYBRID_MULTIARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/multiarray.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! Marks an extent of a #multiarray_shape as being set at run time.
+constexpr  std::size_t  dynamic_extent = static_cast<std::size_t>( -1 );
+
+//! \cond
+namespace detail
+{
+    //! Count the run-time extents in a list.
+    constexpr
+    std::size_t  count_dynamic_extents() noexcept  { return 0u; }
+    //! \overload
+    template < typename ...T >
+    constexpr
+    std::size_t  count_dynamic_extents( std::size_t e, T ...rest ) noexcept
+    { return ( e == dynamic_extent ) + count_dynamic_extents( rest... ); }
+
+    //! Product of the fixed extents in a list.
+    constexpr
+    std::size_t  static_extent_product() noexcept  { return 1u; }
+    //! \overload
+    template < typename ...T >
+    constexpr
+    std::size_t  static_extent_product( std::size_t e, T ...rest ) noexcept
+    {
+        return ( e == dynamic_extent ? 1u : e ) * static_extent_product(
+         rest... );
+    }
+
+    //! Find where the run-time extent for dimension `r` is kept.
+    constexpr
+    std::size_t  dynamic_extent_slot( std::size_t const *e, std::size_t r )
+     noexcept
+    {
+        return r ? ( e[0] == dynamic_extent ) + dynamic_extent_slot( e + 1, r -
+         1u ) : 0u;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Extent-list class template definition  -----------------------------------//
+
+/** \brief  A list of extents, each either fixed or #dynamic_extent.
+
+    \tparam Extents  The size of each dimension, in row-major order.  A value
+                     of #dynamic_extent means that extent is given at run time.
+                     Fixed extents must be positive.
+ */
+template < std::size_t ...Extents >
+struct multiarray_shape
+{
+    //! The number of extents.
+    static constexpr  std::size_t          rank = sizeof...( Extents );
+    //! The number of extents given at run time.
+    static constexpr  std::size_t  rank_dynamic =
+     detail::count_dynamic_extents( Extents... );
+};
+
+//! Gives definition to the number of extents.
+template < std::size_t ...Extents >
+constexpr  std::size_t  multiarray_shape<Extents...>::rank;
+
+//! Gives definition to the number of run-time extents.
+template < std::size_t ...Extents >
+constexpr  std::size_t  multiarray_shape<Extents...>::rank_dynamic;
+
+
+//  Hybrid-extent multi-dimensional array adapter class template definition  -//
+
+/** \brief  A container adapter to view a multi-dimensional array, where each
+            extent is either fixed or set at run time.
+
+This class template sits between #array_md, where every extent is a template
+argument, and #multiarray, where every extent is set at run time.  Each extent
+listed in `Shape` is either a fixed positive value or #dynamic_extent.  The
+fixed ones are constant-folded into the offset arithmetic and into the loops of
+#apply, so a shape like `multiarray_shape<dynamic_extent, 3, 3>` costs one
+run-time multiply per access.
+
+To keep the strides of fixed extents known at compile time, the layout is always
+row-major, like built-in arrays and #array_md.  Otherwise the interface, the
+sizing rules, and the relationship with the internal container match those of
+#multiarray.
+
+    \pre  `Element` can be used as a container element type.
+    \pre  `Element` is the element type for `Container`.
+    \pre  `Container` should be a sequence-container that supports random-access
+          iterators.  It has to have at least the `begin`, `size`, `empty`, and
+          `swap` member functions (plus needed support types and type-aliases),
+          with their expected Standard semantics.
+
+    \tparam Element    The type of the elements.
+    \tparam Shape      A #multiarray_shape instantiation listing the extents.
+    \tparam Container  The internal container for the elements.  If not given,
+                       defaults to `std::vector<Element>`.
+
+ */
+template <
+    typename Element, class Shape, class Container = std::vector<Element>
+>
+class hybrid_multiarray;
+
+/** \brief  The sole implementation of `hybrid_multiarray`.
+
+    \tparam Element    The type of the elements.
+    \tparam Extents    The size of each dimension, or #dynamic_extent.
+    \tparam Container  The internal container for the elements.
+ */
+template < typename Element, std::size_t ...Extents, class Container >
+class hybrid_multiarray< Element, multiarray_shape<Extents...>, Container >
+{
+    static_assert( std::is_same<Element, typename Container::value_type>::value,
+     "Container doesn't hold right kind of element" );
+    static_assert( detail::static_extent_product(Extents...) > 0u,
+     "Fixed extents have to be positive" );
+
+public:
+    // Template parameters
+    //! The element type.  Gives access to its template parameter.
+    typedef Element                     value_type;
+    //! The extent list.  Gives access to its template parameter.
+    typedef multiarray_shape<Extents...>  shape_type;
+    //! The container type.  Gives access to its template parameter.
+    typedef Container               container_type;
+
+    // Other types
+    //! The type for referring to an element.
+    typedef typename container_type::reference              reference;
+    //! The type for referring to an element, immutable access.
+    typedef typename container_type::const_reference  const_reference;
+    //! The type for size-based meta-data.
+    typedef typename container_type::size_type              size_type;
+
+    // Sizing parameters
+    //! The number of extents.
+    static constexpr  size_type  dimensionality = sizeof...( Extents );
+    //! The number of extents that are set at run time.
+    static constexpr  size_type    dynamic_rank = shape_type::rank_dynamic;
+    //! The extents as given in the template arguments.  Run-time extents show
+    //! up as #dynamic_extent.
+    static constexpr  std::size_t  static_sizes[ dimensionality +
+     !dimensionality ] = { Extents... };
+
+    //! The type for giving and receiving extent or priority lists.
+    typedef std::array<size_type, dimensionality>  stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Default constructor
+        \post  #c is default-initialized.
+        \post  The first run-time extent, if any, is the largest value that
+               makes #required_size() fit in `c.size()`, but at least 1.  Any
+               other run-time extents are 1.
+     */
+              hybrid_multiarray()  : c()  { resize_to_fit(); }
+    /** \brief  Initialize with a copy of the given container
+        \param cc  The container to copy from.
+        \post  #c is equivalent to `cc`.
+        \post  The first run-time extent, if any, is the largest value that
+               makes #required_size() fit in `c.size()`, but at least 1.  Any
+               other run-time extents are 1.
+     */
+    explicit  hybrid_multiarray( container_type const &cc )  : c( cc )
+    { resize_to_fit(); }
+    /** \brief  Initialize from moving in the given container
+        \param cc  The container to move from.
+        \post  #c is equivalent to the pre-move state of `cc`.  The state of
+               `cc` is unspecified.
+        \post  The first run-time extent, if any, is the largest value that
+               makes #required_size() fit in `c.size()`, but at least 1.  Any
+               other run-time extents are 1.
+     */
+    explicit  hybrid_multiarray( container_type &&cc )  : c( std::move(cc) )
+    { resize_to_fit(); }
+
+    // Status
+    //! \returns  The number of elements needed to support all valid index-tuple
+    //!           combinations.  (Equals the product of all index extents.)
+    size_type  required_size() const
+    {
+        return std::accumulate( std::begin(dynamic_sizes), std::begin(
+         dynamic_sizes ) + dynamic_rank, static_cast<size_type>(
+         detail::static_extent_product(Extents...) ),
+         std::multiplies<size_type>{} );
+    }
+    //! \returns  `size() == 0`; i.e. if there are no elements.
+    bool           empty() const  { return c.empty(); }
+    //! \returns  The number of stored elements (of #value_type).
+    size_type       size() const  { return c.size(); }
+
+    //! \returns  The fixed extent of dimension `r`, or #dynamic_extent.
+    //! \pre  `r < dimensionality`.
+    static constexpr
+    std::size_t  static_extent( size_type r )  { return static_sizes[ r ]; }
+
+    //! \returns  The current extent of dimension `r`.
+    //! \pre  `r < dimensionality`.
+    size_type   extent( size_type r ) const
+    {
+        return static_sizes[ r ] == dynamic_extent ? dynamic_sizes[
+         detail::dynamic_extent_slot(static_sizes, r) ] : static_sizes[ r ];
+    }
+    //! \returns  The current extent for each index.
+    stats_type  extents() const
+    {
+        stats_type  result;
+        size_type   slot = 0u;
+
+        for ( size_type  i = 0u ; i < dimensionality ; ++i )
+            result[ i ] = static_sizes[ i ] == dynamic_extent ? dynamic_sizes[
+             slot++ ] : static_sizes[ i ];
+        return result;
+    }
+    /** \brief    Sets the extent for each index.
+        \details  Only the run-time extents can actually change, but the full
+                  list has to be given, for compatibility with #multiarray.
+        \pre  There is no element in `e` equal to 0.
+        \pre  Each fixed extent is given its fixed value.
+        \pre  The product of the elements of `e` cannot exceed the maximum value
+              supported by #size_type.
+        \param e  The array of new extents.
+        \throws std::out_of_range      when any element of `e` is zero.
+        \throws std::invalid_argument  when a fixed extent is given a different
+                                       value.
+        \throws std::overflow_error    when the product of `e`'s elements
+                                       exceeds the limit of `size_type`.
+        \post  `extents() == e`.
+     */
+    void        extents( stats_type const &e )
+    {
+        size_type    limit = 1u;
+        auto const     max = std::numeric_limits<size_type>::max();
+
+        for ( size_type  i = 0u ; i < dimensionality ; ++i )
+        {
+            if ( !e[i] )
+                throw std::out_of_range{ "Zero-sized extent" };
+            if ( static_sizes[i] != dynamic_extent && e[i] != static_sizes[i] )
+                throw std::invalid_argument{ "Fixed extent can't change" };
+            if ( e[i] > max / limit )
+                throw std::overflow_error{ "Total element count too large" };
+            limit *= e[ i ];
+        }
+
+        // No more problems, do the transfer.
+        size_type  slot = 0u;
+
+        for ( size_type  i = 0u ; i < dimensionality ; ++i )
+            if ( static_sizes[i] == dynamic_extent )
+                dynamic_sizes[ slot++ ] = e[ i ];
+    }
+    /** \overload
+        \details  Does `extents( {{e0, e...}} )`.
+        \pre  There are exactly #dimensionality arguments given.
+        \param e0  The first extent.
+        \param e   The remaining extents.
+        \post  `extents() == {{ e0, e... }}`.
+     */
+    template <
+        typename ...Args,
+        typename         = typename std::enable_if<1 + sizeof...(Args) ==
+         dimensionality>::type
+    >
+    void        extents( size_type e0, Args &&...e )
+    { extents(stats_type{ {e0, static_cast<size_type>(std::forward<Args>( e
+     ))...} }); }
+
+    //! \returns  The index priority list, which is always row-major.
+    stats_type  priorities() const
+    {
+        stats_type  result;
+
+        std::iota( result.begin(), result.end(), size_type(0) );
+        return result;
+    }
+
+    // Access
+    /** \brief  Access to element data, full depth.
+        \pre    `i.size() == dimensionality`, and each index is less than its
+                extent.  Not checked.
+        \param i  The list of indexes needed to locate the element.
+        \returns  A reference to the selected element.
+     */
+          reference  operator ()( std::initializer_list<size_type> i )
+    { return *std::next( std::begin(c), list_to_offset(i, false) ); }
+    //! \overload
+    const_reference  operator ()( std::initializer_list<size_type> i ) const
+    { return *std::next( std::begin(c), list_to_offset(i, false) ); }
+    /** \overload
+        \pre  There are exactly #dimensionality arguments given.
+        \pre  Each entry of `args` has to implicitly convert to `size_type`.
+        \param args  The individual indexes.
+        \details  The fixed extents fold into the offset arithmetic.
+     */
+    template < typename ...Args >       reference  operator ()( Args &&...args )
+    {
+        static_assert( sizeof...(Args) == dimensionality, "Wrong index count" );
+
+        return *std::next( std::begin(c), pack_to_offset(static_cast<size_type>(
+         std::forward<Args>( args ))...) );
+    }
+    //! \overload
+    template < typename ...Args > const_reference  operator ()( Args &&...args )
+     const
+    {
+        static_assert( sizeof...(Args) == dimensionality, "Wrong index count" );
+
+        return *std::next( std::begin(c), pack_to_offset(static_cast<size_type>(
+         std::forward<Args>( args ))...) );
+    }
+
+    /** \brief  Checked element access.
+        \param i  The list of indexes needed to locate the element.
+        \throws std::length_error  if the number of indexes is wrong.
+        \throws std::out_of_range  if at least one index is not less than its
+                                   corresponding extent.
+        \returns  A reference to the selected element.
+     */
+          reference  at( std::initializer_list<size_type> i )
+    {
+        // Check before getting a mutable iterator, which may copy the elements
+        auto const  offset = list_to_offset( i, true );
+
+        return *std::next( std::begin(c), offset );
+    }
+    //! \overload
+    const_reference  at( std::initializer_list<size_type> i ) const
+    { return *std::next( std::begin(c), list_to_offset(i, true) ); }
+    /** \overload
+        \pre  Each entry of `args` has to implicitly convert to `size_type`.
+        \param args  The individual indexes.
+     */
+    template < typename ...Args >        reference  at( Args &&...args )
+    { return at( {static_cast<size_type>(std::forward<Args>( args ))...} ); }
+    //! \overload
+    template < typename ...Args >  const_reference  at( Args &&...args ) const
+    { return at( {static_cast<size_type>(std::forward<Args>( args ))...} ); }
+
+    //! \returns  `operator ()( i )`.
+          reference  operator []( std::initializer_list<size_type> i )
+    { return operator ()(i); }
+    //! \overload
+    const_reference  operator []( std::initializer_list<size_type> i ) const
+    { return operator ()(i); }
+
+    // Assignments
+    /** \brief    Fill elements with specified value.
+        \details  Assigns the given value to all the elements.  If the number of
+                  stored elements differs from the amount needed, iteration will
+                  stop at the shorter length.
+        \param v  The value of the assignment source.
+        \throws Whatever  assignment for #value_type throws.
+        \post     Each element is equivalent to *v*.
+     */
+    void  fill( const_reference v )
+    { std::fill_n(std::begin( c ), std::min( required_size(), size() ), v); }
+
+    /** \brief  Swaps states with another object.
+        \param other  The object to trade state with.
+        \throws  Whatever  the container-level swap throws.
+        \post  `*this` is equivalent to the old state of *other*, while that
+               object is equivalent to the old state of `*this`.
+     */
+    void  swap( hybrid_multiarray &other )
+     noexcept( detail::is_swap_nothrow_too<container_type>() )
+    {
+        using std::swap;
+
+        swap( c, other.c );
+        std::swap( dynamic_sizes, other.dynamic_sizes );
+    }
+
+    /** \brief    Calls function on all elements, with indices.
+        \details  Loops through all the extant elements in memory order, calling
+                  the given function with the element and its index coordinates.
+                  When the internal container has at least #required_size()
+                  elements, the loops are nested per dimension, so fixed extents
+                  give fixed trip counts.
+        \param f  The function, function-pointer, function-object, or lambda
+                  that will execute the code.  It has to take #dimensionality +
+                  1 arguments.  The first argument must be compatible with
+                  #value_type (or (immutable) reference of); subsequent
+                  arguments have to be compatible with #size_type.
+        \post     Unspecified, since *f* is allowed to alter the elements (when
+                  taking a mutable reference) and/or itself during the calls.
+     */
+    template < typename Function >
+    void  apply( Function &&f )
+    {
+        auto  current = std::begin( c );
+
+        if ( size() >= required_size() )
+            nested_apply( std::integral_constant<std::size_t, 0u>{}, f,
+             current );
+        else
+            flat_apply( f, current );
+    }
+    //! \overload
+    template < typename Function >
+    void  apply( Function &&f ) const
+    {
+        auto  current = std::begin( c );
+
+        if ( size() >= required_size() )
+            nested_apply( std::integral_constant<std::size_t, 0u>{}, f,
+             current );
+        else
+            flat_apply( f, current );
+    }
+    /** \brief    Calls function on all elements, with indices, immutable access
+        \param f  The function, function-pointer, function-object, or lambda
+                  that will execute the code.
+        \see      #apply
+     */
+    template < typename Function >
+    void  capply( Function &&f ) const
+    { apply(std::forward<Function>( f )); }
+
+protected:
+    /** \brief    The container for the element data.
+        \details  It is not private so derived classes can mess with it.
+     */
+    container_type  c;
+
+private:
+    // Set the run-time extents to match the container's size.
+    void  resize_to_fit()
+    {
+        std::fill( std::begin(dynamic_sizes), std::end(dynamic_sizes),
+         size_type(1) );
+        if ( dynamic_rank )
+            dynamic_sizes[ 0 ] = std::max<size_type>( c.size() /
+             detail::static_extent_product(Extents...), 1u );
+    }
+
+    // The extent of a compile-time dimension; fixed ones become constants.
+    template < std::size_t D >
+    size_type  extent_at( std::true_type ) const
+    {
+        return dynamic_sizes[ std::integral_constant<std::size_t,
+         detail::dynamic_extent_slot(static_sizes, D)>::value ];
+    }
+    template < std::size_t D >
+    size_type  extent_at( std::false_type ) const  { return static_sizes[ D ]; }
+    template < std::size_t D >
+    size_type  extent_at() const
+    {
+        return extent_at<D>( std::integral_constant<bool, static_sizes[D] ==
+         dynamic_extent>{} );
+    }
+
+    // Row-major offsets via Horner's rule, one dimension at a time.
+    template < std::size_t D >
+    size_type  horner( size_type acc ) const  { return acc; }
+    template < std::size_t D, typename ...Rest >
+    size_type  horner( size_type acc, size_type i, Rest ...rest ) const
+    { return horner<D + 1u>( acc * extent_at<D>() + i, rest... ); }
+
+    size_type  pack_to_offset() const  { return 0u; }
+    template < typename ...Rest >
+    size_type  pack_to_offset( size_type i0, Rest ...rest ) const
+    { return horner<1u>( i0, rest... ); }
+
+    size_type  list_to_offset( std::initializer_list<size_type> i, bool
+     throw_on_bad_input ) const
+    {
+        auto const  e = extents();
+        auto        ee = e.begin();
+        size_type   result = 0u;
+
+        if ( throw_on_bad_input && i.size() != dimensionality )
+            throw std::length_error{ "Wrong number of indexes" };
+        for ( auto const  ii : i )
+        {
+            if ( throw_on_bad_input && ii >= *ee )
+                throw std::out_of_range{ "Index too large" };
+            result = result * *ee++ + ii;
+        }
+        return result;
+    }
+
+    // Loop nests for "apply"
+    template < typename Function, typename Iterator, typename ...Indices >
+    void  nested_apply( std::integral_constant<std::size_t, dimensionality>,
+     Function &f, Iterator &current, Indices ...i ) const
+    { f( *current, i... ); ++current; }
+    template < std::size_t D, typename Function, typename Iterator, typename
+     ...Indices >
+    void  nested_apply( std::integral_constant<std::size_t, D>, Function &f,
+     Iterator &current, Indices ...i ) const
+    {
+        for ( size_type  k = 0u, e = extent_at<D>() ; k < e ; ++k )
+            nested_apply( std::integral_constant<std::size_t, D + 1u>{}, f,
+             current, i..., k );
+    }
+
+    // The general loop for "apply," for an undersized container
+    template < typename Function, typename Iterator >
+    void  flat_apply( Function &f, Iterator &current ) const
+    {
+        auto const  e = extents();
+        stats_type  indexes{};
+
+        for ( auto  limit = size() ; limit-- ; )
+        {
+            detail::apply_x_and_exploded_tuple( f, *current++, indexes );
+            for ( auto  i = dimensionality ; i-- ; )
+            {
+                if ( ++indexes[i] < e[i] )
+                    break;
+                indexes[ i ] = 0u;
+            }
+        }
+    }
+
+    // The run-time extents, in order
+    size_type  dynamic_sizes[ dynamic_rank + !dynamic_rank ];
+};
+
+
+//  Class-static data member definitions  ------------------------------------//
+
+//! The number of extents.
+template < typename Element, std::size_t ...Extents, class Container >
+constexpr
+typename hybrid_multiarray<Element, multiarray_shape<Extents...>,
+ Container>::size_type  hybrid_multiarray<Element, multiarray_shape<Extents...>,
+ Container>::dimensionality;
+
+//! The number of run-time extents.
+template < typename Element, std::size_t ...Extents, class Container >
+constexpr
+typename hybrid_multiarray<Element, multiarray_shape<Extents...>,
+ Container>::size_type  hybrid_multiarray<Element, multiarray_shape<Extents...>,
+ Container>::dynamic_rank;
+
+//! The extents as given in the template arguments.
+template < typename Element, std::size_t ...Extents, class Container >
+constexpr
+std::size_t  hybrid_multiarray<Element, multiarray_shape<Extents...>,
+ Container>::static_sizes[];
+
+
+//  Hybrid-extent multi-dimensional array adapter, other operations  ---------//
+
+/** \brief  Swap routine for `hybrid_multiarray`.
+    \param a  The first object to have its state exchanged.
+    \param b  The second object to have its state exchanged.
+    \throws Whatever  the container-level swap does.
+    \post  `a` is equivalent to the old state of `b`, while `b` is equivalent to
+           the old state of `a`.
+ */
+template < typename T, class Shape, class Cont >
+void  swap( hybrid_multiarray<T, Shape, Cont> &a, hybrid_multiarray<T, Shape,
+ Cont> &b ) noexcept( noexcept(a.swap( b )) )
+{ a.swap(b); }
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_HYBRID_MULTIARRAY_HPP
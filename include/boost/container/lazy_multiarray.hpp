@@ -0,0 +1,429 @@
+//  Boost Lazy Multi-dimensional Array header file  --------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template for multi-dimensional arrays whose elements are
+      computed from their index coordinates when first read.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template holding a
+    generator function and the elements it has produced so far.  Elements are
+    computed a block at a time on first access, with a bitmap recording the
+    finished blocks, so tables that are expensive to build but sparsely read
+    only pay for what's used.  Readers on several threads may trigger
+    computation at once; each block is still computed only once.  The whole
+    table can also be computed ahead of time, in parallel.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_LAZY_MULTIARRAY_HPP
+#define BOOST_CONTAINER_LAZY_MULTIARRAY_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Call a function with the entries of an index list as the arguments.
+    template < typename Function, typename SizeType, std::size_t Rank,
+     std::size_t ...I >
+    inline
+    auto  call_with_indexes( Function const &f, std::array<SizeType, Rank> const
+     &i, seq<I...> ) -> decltype( f(i[ I ]...) )
+    { return f( i[I]... ); }
+
+    //! The result of calling a function with the given number of indexes.
+    template < typename Function, std::size_t Rank >
+    struct generator_result
+    {
+        typedef typename std::decay<decltype( call_with_indexes(
+         std::declval<Function const &>(), std::declval<std::array<std::size_t,
+         Rank> const &>(), typename gen_seq<Rank>::type{} ) )>::type  type;
+    };
+
+    /** \brief  Frees the table of element blocks of a #lazy_multiarray.
+
+    Each entry is either null or a block whose elements were all constructed.
+    Only the latter are destroyed and deallocated.
+     */
+    template < typename T, std::size_t BlockSize >
+    struct lazy_block_deleter
+    {
+        std::size_t  total;
+
+        void  operator ()( T **table ) const noexcept
+        {
+            std::allocator<T>  alloc;
+
+            for ( std::size_t  first = 0u ; first < total ; first += BlockSize )
+                if ( auto const  p = table[first / BlockSize] )
+                {
+                    auto const  n = std::min( BlockSize, total - first );
+
+                    destroy_elements( p, n );
+                    alloc.deallocate( p, n );
+                }
+            delete [] table;
+        }
+
+        //! Destroy the first `n` elements at `p`, last to first.
+        static  void  destroy_elements( T *p, std::size_t n ) noexcept
+        {
+            while ( n-- )
+                p[ n ].~T();
+        }
+    };
+
+}  // namespace detail
+//! \endcond
+
+
+//  Lazy multi-dimensional array class template definition  ------------------//
+
+/** \brief  A read-only array whose elements are computed on first access.
+
+The element at `(i0, ..., iN)` is `f( i0, ..., iN )` for the generator `f`
+given at construction.  The elements are split into blocks of `BlockSize`
+consecutive elements in row-major order (the last block may be shorter).  The
+first read of any element of a block allocates the block and constructs all of
+its elements, and a bit in the block bitmap marks it done.  Later reads just
+check the bit.  No element storage exists until its block is needed, so setting
+up even a huge table only costs the bitmaps and a table of block pointers.
+
+Reading from several threads at once is safe.  If two threads need the same
+unfinished block, one computes it while the other waits, so the generator is
+called once per element.  If the generator throws, the block stays unfinished
+and the exception goes to the reader that triggered it; a later read tries
+again.
+
+#materialize_all computes every unfinished block ahead of time, split among
+threads.
+
+    \pre  `Generator` can be called, as an immutable object, with
+          #dimensionality `size_type` arguments, giving something `T` can be
+          constructed from.  Calls from different threads may overlap.
+
+    \tparam T          The element type.
+    \tparam Rank       The number of index coordinates to locate an element.
+    \tparam Generator  The type of the function computing the elements.
+    \tparam BlockSize  The number of elements computed together.
+ */
+template < typename T, std::size_t Rank, class Generator, std::size_t
+ BlockSize = 1024u >
+class lazy_multiarray
+{
+    static_assert( BlockSize > 0u, "Blocks must have elements" );
+
+    typedef std::atomic<std::uint64_t>                    bitmap_word;
+    typedef detail::lazy_block_deleter<T, BlockSize>  block_deleter;
+
+public:
+    // Template parameters
+    //! The element type.  Gives access to its template parameter.
+    typedef T                          value_type;
+    //! The generator type.  Gives access to its template parameter.
+    typedef Generator              generator_type;
+    //! The number of extents.  Gives access to its template parameter.
+    static constexpr  std::size_t  dimensionality = Rank;
+    //! The number of elements per block.  Gives access to its template
+    //! parameter.
+    static constexpr  std::size_t      block_size = BlockSize;
+
+    // Other types
+    //! The type for size-based meta-data.
+    typedef std::size_t                     size_type;
+    //! The type for lists of extents and indexes.
+    typedef std::array<size_type, Rank>    stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined move-ctr and destructor; no copying.)
+    /** \brief  Set up an array of the given shape, with nothing computed.
+        \param e  The extents.
+        \param f  The generator.
+        \throws std::out_of_range  if any extent is zero.
+        \throws std::overflow_error  if the element count is too large.
+        \throws Whatever  memory allocation throws.
+        \post  `extents() == e && materialized_count() == 0`.
+     */
+    lazy_multiarray( stats_type const &e, Generator f )
+      : shape( checked(e) ), generator( std::move(f) ), total( count(e) ),
+        bitmap_words( (blocks_for( total ) + 63u) / 64u ),
+        ready( new bitmap_word[bitmap_words] ),
+        claimed( new bitmap_word[bitmap_words] ),
+        blocks( new T *[blocks_for( total )](), block_deleter{total} )
+    {
+        for ( size_type  w = 0u ; w < bitmap_words ; ++w )
+        {
+            ready[ w ].store( 0u, std::memory_order_relaxed );
+            claimed[ w ].store( 0u, std::memory_order_relaxed );
+        }
+    }
+
+    // Observers
+    //! \returns  The extent of each index.
+    stats_type       extents() const noexcept  { return shape; }
+    //! \returns  The number of elements.
+    size_type           size() const noexcept  { return total; }
+    //! \returns  The generator.
+    Generator const &  generator_function() const noexcept
+    { return generator; }
+
+    // Element access
+    /** \brief  Access an element, computing its block if needed.
+        \pre  `i[k] < extents()[k]` for each `k`.
+        \param i  The index coordinates.
+        \throws Whatever  the generator throws.
+        \returns  A reference to the element.  It stays valid, and unchanged,
+                  for the life of `*this`.
+     */
+    template < typename ...Args >
+    value_type const &  operator ()( Args const &...i ) const
+    {
+        static_assert( sizeof...(Args) == Rank, "Wrong number of indexes" );
+
+        return get( offset_of(stats_type{{ static_cast<size_type>(i)... }}) );
+    }
+    /** \brief  Access an element, computing its block if needed, with checks.
+        \param i  The index coordinates.
+        \throws std::out_of_range  if some `i[k] >= extents()[k]`.
+        \throws Whatever  the generator throws.
+        \returns  A reference to the element.
+     */
+    template < typename ...Args >
+    value_type const &  at( Args const &...i ) const
+    {
+        static_assert( sizeof...(Args) == Rank, "Wrong number of indexes" );
+
+        stats_type const  index{{ static_cast<size_type>(i)... }};
+
+        for ( size_type  k = 0u ; k < Rank ; ++k )
+            if ( index[k] >= shape[k] )
+                throw std::out_of_range{ "Index too large" };
+        return get( offset_of(index) );
+    }
+
+    // Materialization
+    //! \returns  The number of blocks.
+    size_type  block_count() const noexcept  { return blocks_for( total ); }
+    //! \returns  Whether block `b` has been computed.
+    bool  is_materialized( size_type b ) const noexcept
+    { return ready[ b / 64u ].load(std::memory_order_acquire) & bit( b ); }
+    //! \returns  The number of computed blocks.
+    size_type  materialized_count() const noexcept
+    {
+        size_type  result = 0u;
+
+        for ( size_type  b = 0u ; b < block_count() ; ++b )
+            result += is_materialized( b );
+        return result;
+    }
+
+    /** \brief  Compute block `b`, if not already done.
+        \pre  `b < block_count()`.
+        \param b  The block to compute.
+        \throws Whatever  the generator throws.
+        \post  `is_materialized( b )`.
+     */
+    void  materialize_block( size_type b ) const
+    {
+        auto const  mask = bit( b );
+        auto &      r = ready[ b / 64u ];
+        auto &      c = claimed[ b / 64u ];
+
+        while ( !(r.load( std::memory_order_acquire ) & mask) )
+        {
+            if ( !(c.fetch_or( mask, std::memory_order_acq_rel ) & mask) )
+            {
+                // This thread won the claim, so it computes the block.
+                try
+                {
+                    fill_block( b );
+                }
+                catch ( ... )
+                {
+                    c.fetch_and( ~mask, std::memory_order_release );
+                    throw;
+                }
+                r.fetch_or( mask, std::memory_order_release );
+                return;
+            }
+
+            // Another thread has it; wait until it finishes or gives up.
+            while ( !(r.load( std::memory_order_acquire ) & mask) &&
+             (c.load( std::memory_order_acquire ) & mask) )
+                std::this_thread::yield();
+        }
+    }
+
+    /** \brief  Compute every unfinished block ahead of time.
+        \param threads  The maximum number of threads to use.  If zero (the
+                        default), chosen automatically.
+        \throws Whatever  the generator throws.  Blocks finished before then
+                          stay finished.
+        \post  `materialized_count() == block_count()`.
+     */
+    void  materialize_all( unsigned threads = 0u ) const
+    {
+        detail::parallel_chunks( block_count(), detail::thread_count_for(size(),
+         threads), [this]( size_type b, size_type e ){
+            for ( ; b < e ; ++b )
+                materialize_block( b );
+        } );
+    }
+
+private:
+    static  stats_type  checked( stats_type const &e )
+    {
+        count( e );
+        return e;
+    }
+    static  size_type  count( stats_type const &e )
+    {
+        size_type  result = 1u;
+
+        for ( auto const  x : e )
+        {
+            if ( !x )
+                throw std::out_of_range{ "Zero-sized extent" };
+            if ( x > std::numeric_limits<size_type>::max() / result )
+                throw std::overflow_error{ "Total element count too large" };
+            result *= x;
+        }
+        return result;
+    }
+    static  size_type  blocks_for( size_type n ) noexcept
+    { return n / BlockSize + !!( n % BlockSize ); }
+    static  std::uint64_t  bit( size_type b ) noexcept
+    { return std::uint64_t( 1u ) << b % 64u; }
+
+    size_type  offset_of( stats_type const &i ) const noexcept
+    {
+        size_type  result = 0u;
+
+        for ( size_type  k = 0u ; k < Rank ; ++k )
+            result = result * shape[ k ] + i[ k ];
+        return result;
+    }
+
+    value_type const &  get( size_type offset ) const
+    {
+        auto const  b = offset / BlockSize;
+
+        if ( !is_materialized(b) )
+            materialize_block( b );
+        return blocks[ b ][ offset % BlockSize ];
+    }
+
+    // Allocate a block and construct its elements in row-major order,
+    // stepping the indexes.  On failure, the block is left unallocated.
+    void  fill_block( size_type b ) const
+    {
+        auto const         first = b * BlockSize;
+        auto const         n = std::min( BlockSize, total - first );
+        std::allocator<T>  alloc;
+        T * const          p = alloc.allocate( n );
+        size_type          built = 0u;
+        stats_type         index;
+
+        for ( size_type  k = Rank, r = first ; k-- ; r /= shape[k] )
+            index[ k ] = r % shape[ k ];
+        try
+        {
+            for ( ; built < n ; ++built )
+            {
+                ::new ( static_cast<void *>(p + built) ) T(
+                 detail::call_with_indexes(generator, index, typename
+                 detail::gen_seq<Rank>::type{}) );
+                for ( size_type  k = Rank ; k-- ; )
+                {
+                    if ( ++index[k] < shape[k] )
+                        break;
+                    index[ k ] = 0u;
+                }
+            }
+        }
+        catch ( ... )
+        {
+            block_deleter::destroy_elements( p, built );
+            alloc.deallocate( p, n );
+            throw;
+        }
+        blocks[ b ] = p;
+    }
+
+    stats_type                      shape;
+    Generator                       generator;
+    size_type                       total, bitmap_words;
+    std::unique_ptr<bitmap_word[]>  ready, claimed;
+    // A block's entry is set only by the thread that claimed it, and read
+    // only after its ready bit is seen.
+    std::unique_ptr<T *[], block_deleter>  blocks;
+};
+
+//! Gives definition to the number of extents.
+template < typename T, std::size_t Rank, class Generator, std::size_t
+ BlockSize >
+constexpr
+std::size_t  lazy_multiarray<T, Rank, Generator, BlockSize>::dimensionality;
+
+//! Gives definition to the block size.
+template < typename T, std::size_t Rank, class Generator, std::size_t
+ BlockSize >
+constexpr
+std::size_t  lazy_multiarray<T, Rank, Generator, BlockSize>::block_size;
+
+/** \brief  Set up a lazy array, with the element type taken from the generator.
+    \param e  The extents.
+    \param f  The generator.
+    \throws Whatever  the #lazy_multiarray constructor throws.
+    \returns  A #lazy_multiarray with the default block size.
+ */
+template < std::size_t Rank, class Generator >
+inline
+auto  make_lazy_multiarray( std::array<std::size_t, Rank> const &e, Generator
+ f ) -> lazy_multiarray<typename detail::generator_result<Generator,
+ Rank>::type, Rank, Generator>
+{
+    return lazy_multiarray<typename detail::generator_result<Generator,
+     Rank>::type, Rank, Generator>( e, std::move(f) );
+}
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_LAZY_MULTIARRAY_HPP
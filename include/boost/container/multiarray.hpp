@@ -43,6 +43,8 @@
 #include <vector>
 
 // Put Boost #includes here.
+#include "boost/type_traits/indexing.hpp"
+#include "boost/utility/slice.hpp"
 
 
 namespace boost
@@ -125,9 +127,12 @@ class.
     \tparam Element    The type of the elements.
     \tparam Container  The internal container for the elements.  If not given,
                        defaults to `std::vector<Element>`.
+    \tparam IndexType  The type of the index coordinates.  If not given,
+                       defaults to `Container::size_type`.
 
  */
-template < typename Element, class Container = std::vector<Element> >
+template < typename Element, class Container = std::vector<Element>, typename
+ IndexType = typename Container::size_type >
 class multiarray_storage_base
 {
     static_assert( std::is_same<Element, typename Container::value_type>::value,
@@ -147,6 +152,8 @@ public:
     using const_reference = typename container_type::const_reference;
     //! The type for size-based meta-data.
     using  size_type      = typename container_type::size_type;
+    //! The type for index coordinates.  Gives access to its template parameter.
+    using index_type      = IndexType;
 
     // Container status
     //! \returns  `size() == 0`; i.e. if there are no elements.
@@ -164,42 +171,34 @@ public:
                   returns a reference to the element with that offset from
                   `begin`.
      */
-          reference  operator ()( std::initializer_list<size_type> i )
-    {
-        return const_cast<reference>( const_cast<multiarray_storage_base const
-         *>(this)->operator ()(i) );
-    }
+          reference  operator ()( std::initializer_list<index_type> i )
+    { return *element( i.begin(), i.end(), false ); }
     //! \overload
-    const_reference  operator ()( std::initializer_list<size_type> i ) const
-    {
-        auto  ci = c.begin();
-
-        std::advance( ci, get_offset(i.begin(), i.end(), false) );
-        return *ci;
-    }
+    const_reference  operator ()( std::initializer_list<index_type> i ) const
+    { return *element( i.begin(), i.end(), false ); }
     /** \overload
-        \pre  Each entry of `args` has to implicitly convert to `size_type`.
+        \pre  Each entry of `args` has to implicitly convert to `index_type`.
         \param args  The individual indexes.
         \returns  `operator ()( {args...} )`.
-        \see  #operator()(std::initializer_list<size_type>)
+        \see  #operator()(std::initializer_list<index_type>)
      */
     template < typename ...Args >       reference  operator()( Args &&...args )
     {
-        return const_cast<reference>( const_cast<multiarray_storage_base const
-         *>(this)->operator ()(std::forward<Args>( args )...) );
+        constexpr auto   al = sizeof...( Args );
+        index_type const  indexes[ al + !al ] = {
+         static_cast<index_type>(std::forward<Args>( args ))... };
+
+        return *element( std::begin(indexes), std::end(indexes) - !al, false );
     }
     //! \overload
     template < typename ...Args > const_reference  operator()( Args &&...args )
      const
     {
         constexpr auto   al = sizeof...( Args );
-        size_type const  indexes[ al + !al ] = {
-         static_cast<size_type>(std::forward<Args>( args ))... };
-        auto             ci = c.begin();
+        index_type const  indexes[ al + !al ] = {
+         static_cast<index_type>(std::forward<Args>( args ))... };
 
-        std::advance( ci, get_offset(std::begin( indexes ), std::end( indexes )
-         - !al, false) );
-        return *ci;
+        return *element( std::begin(indexes), std::end(indexes) - !al, false );
     }
 
     /** \brief  Checked element access.
@@ -212,49 +211,41 @@ public:
                   the correct range.
         \returns  A reference to the selected element.
      */
-          reference  at( std::initializer_list<size_type> i )
-    {
-        return const_cast<reference>( const_cast<multiarray_storage_base const
-         *>(this)->at(i) );
-    }
+          reference  at( std::initializer_list<index_type> i )
+    { return *element( i.begin(), i.end(), true ); }
     //! \overload
-    const_reference  at( std::initializer_list<size_type> i ) const
-    {
-        auto  ci = c.begin();
-
-        std::advance( ci, get_offset(i.begin(), i.end(), true) );
-        return *ci;
-    }
+    const_reference  at( std::initializer_list<index_type> i ) const
+    { return *element( i.begin(), i.end(), true ); }
     /** \overload
-        \pre  Each entry of `args` has to implicitly convert to `size_type`.
+        \pre  Each entry of `args` has to implicitly convert to `index_type`.
         \param args  The individual indexes.
         \returns  `at()( {args...} )`.
-        \see  #at(std::initializer_list<size_type>)
+        \see  #at(std::initializer_list<index_type>)
      */
     template < typename ...Args >        reference  at( Args &&...args )
     {
-        return const_cast<reference>( const_cast<multiarray_storage_base const
-         *>(this)->at(std::forward<Args>( args )...) );
+        constexpr auto   al = sizeof...( Args );
+        index_type const  indexes[ al + !al ] = {
+         static_cast<index_type>(std::forward<Args>( args ))... };
+
+        return *element( std::begin(indexes), std::end(indexes) - !al, true );
     }
     //! \overload
     template < typename ...Args >  const_reference  at( Args &&...args ) const
     {
         constexpr auto   al = sizeof...( Args );
-        size_type const  indexes[ al + !al ] = {
-         static_cast<size_type>(std::forward<Args>( args ))... };
-        auto             ci = c.begin();
+        index_type const  indexes[ al + !al ] = {
+         static_cast<index_type>(std::forward<Args>( args ))... };
 
-        std::advance( ci, get_offset(std::begin( indexes ), std::end( indexes )
-         - !al, true) );
-        return *ci;
+        return *element( std::begin(indexes), std::end(indexes) - !al, true );
     }
 
     //! \returns  `operator ()( i )`.
-    //! \see  #operator()(std::initializer_list<size_type>)
-          reference  operator []( std::initializer_list<size_type> i )
+    //! \see  #operator()(std::initializer_list<index_type>)
+          reference  operator []( std::initializer_list<index_type> i )
     { return operator ()(i); }
     //! \overload
-    const_reference  operator []( std::initializer_list<size_type> i ) const
+    const_reference  operator []( std::initializer_list<index_type> i ) const
     { return operator ()(i); }
 
     // Assignments
@@ -318,8 +309,31 @@ private:
         \returns  The index within the internal container that the external
                   indexes map to.  May be outside the *current* bounds of #c.
      */
-    virtual  size_type  get_offset( size_type const *index_begin, size_type
+    virtual  size_type  get_offset( index_type const *index_begin, index_type
      const *index_end, bool throw_on_bad_input ) const = 0;
+
+    /*  Locate the element for the given indexes.  The mutable version goes
+        through the mutable "begin" of the container, so containers that do
+        work on mutable access (like copy-on-write) see it.  The indexes are
+        checked first, so a bad index doesn't trigger that work.
+     */
+    auto  element( index_type const *ib, index_type const *ie, bool check ) ->
+     decltype( std::begin(c) )
+    {
+        auto const  offset = get_offset( ib, ie, check );
+        auto        ci = std::begin( c );
+
+        std::advance( ci, offset );
+        return ci;
+    }
+    auto  element( index_type const *ib, index_type const *ie, bool check )
+     const -> decltype( std::begin(c) )
+    {
+        auto  ci = std::begin( c );
+
+        std::advance( ci, get_offset(ib, ie, check) );
+        return ci;
+    }
 };
 
 /** \brief  Base class for `multiarray` to track the index bounds and priority
@@ -457,6 +471,19 @@ public:
     void        priorities( size_type p0, Args &&...p )
     { priorities(stats_type{ {p0, std::forward<Args>(p)...} }); }
 
+    /** \returns  The current stride for each index.  Incrementing the index for
+                  dimension `k` moves `strides()[k]` elements in memory.  The
+                  strides are derived from #extents() and #priorities().
+     */
+    stats_type  strides() const
+    {
+        stats_type  result;
+
+        std::copy_n( std::begin(stats[ strides_i ]), dimensionality,
+         result.begin() );
+        return result;
+    }
+
     /** \brief    Sets indexing to use row-major order.
         \details  Calls #priorities(stats_type const&) with a value that sets
                   row-major order.  That order has the first index as the most-
@@ -587,6 +614,38 @@ protected:
         return std::inner_product( ib, ie, std::begin(stats[ strides_i ]),
          size_type(0) );
     }
+    /** \brief    Converts an index tuple to an offset, with one index rotated.
+        \details  Works like #indexes_to_offset(size_type const*,size_type
+                  const*) const, except that the index for dimension `axis` is
+                  treated as circular:  its value is shifted forward by `head`
+                  places, wrapping around at that dimension's extent.
+        \pre  `ie` must be reachable from `ib` with exactly #dimensionality
+              forward iterations.
+        \pre  `axis < dimensionality`.
+        \pre  `head` is less than the extent of dimension `axis`.
+        \param ib    The beginning of the range of indexes to convert.
+        \param ie    The past-the-end of the range of indexes to convert.
+        \param axis  The dimension that wraps around.
+        \param head  The in-memory position of logical index 0 for `axis`.
+        \returns  The singular internal offset mapped to the given external
+                  index tuple, after rotation.
+     */
+    size_type  indexes_to_offset( size_type const *ib, size_type const *ie,
+     size_type axis, size_type head ) const
+    {
+        auto const  logical = ib[ axis ];
+        auto const    space = stats[ extents_i ][ axis ] - head;
+
+        // Unsigned wrap-around makes the correction work in both directions.
+        return indexes_to_offset( ib, ie ) + stats[ strides_i ][ axis ] * (
+         logical < space ? head : size_type(0) - space );
+    }
+
+    // Direct access to the caches, for partial-indexing proxies
+    //! \returns  The address of the first of #dimensionality extents.
+    size_type const *  extents_data() const  { return stats[ extents_i ]; }
+    //! \returns  The address of the first of #dimensionality strides.
+    size_type const *  strides_data() const  { return stats[ strides_i ]; }
 
     // Given a pack of indexes, go to the next one (in memory)
     //! \returns  Starting value of index tuple iteration, no non-zeros.
@@ -695,6 +754,106 @@ constexpr
 typename multiarray_indexed_base<SizeType, Rank>::size_type
 multiarray_indexed_base<SizeType, Rank>::dimensionality;
 
+
+//  Multi-dimensional array adapter partial-indexing proxy definitions  ------//
+
+template < typename Iterator, typename SizeType, std::size_t Remaining >
+class multiarray_subarray;
+
+//! Make the result of an indexing step:  either another proxy, or (after the
+//! last index) a reference to the element.
+template < typename Iterator, typename SizeType, std::size_t Remaining >
+struct multiarray_subarray_maker
+{
+    //! The result of the indexing step.
+    typedef multiarray_subarray<Iterator, SizeType, Remaining>  type;
+
+    //! \returns  A proxy for the given partial index state.
+    static  type  make( Iterator base, SizeType offset, SizeType const *extents,
+     SizeType const *strides )
+    { return type( base, offset, extents, strides ); }
+};
+//! Full-depth specialization, where the element is finally dereferenced.
+template < typename Iterator, typename SizeType >
+struct multiarray_subarray_maker<Iterator, SizeType, 0u>
+{
+    //! The result of the indexing step.
+    typedef typename std::iterator_traits<Iterator>::reference  type;
+
+    //! \returns  A reference to the element at the given offset from `base`.
+    static  type  make( Iterator base, SizeType offset, SizeType const *,
+     SizeType const * )
+    { std::advance( base, offset ); return *base; }
+};
+
+/** \brief  Proxy for a `multiarray` after some, but not all, of its indexes are
+            given.
+
+This type is what `operator []` with a single index returns for a #multiarray
+with at least two dimensions.  It acts like a built-in array slice:  indexing it
+gives either another proxy or, after the last index, a reference to the element.
+It only holds the in-progress offset and pointers to the owner's extents and
+strides, so a chain of `operator []` calls reduces to the same arithmetic as a
+direct offset computation.  The proxy is invalidated by anything that would
+invalidate the owner's iterators, or by changing the owner's shape.
+
+    \tparam Iterator   The owner's container iterator type; `const_iterator` for
+                       immutable access.
+    \tparam SizeType   The type for size-based meta-data.
+    \tparam Remaining  The number of indexes still needed.  Must be positive.
+
+ */
+template < typename Iterator, typename SizeType, std::size_t Remaining >
+class multiarray_subarray
+{
+    static_assert( Remaining > 0u, "Proxies need at least one more index" );
+
+    using maker_type = multiarray_subarray_maker<Iterator, SizeType, Remaining
+     - 1u>;
+
+public:
+    //! The type for size-based meta-data and access indices.
+    typedef SizeType  size_type;
+
+    //! The number of indexes still needed.
+    static constexpr  std::size_t  dimensionality = Remaining;
+
+    //! The result of indexing; another proxy or an element reference.
+    typedef typename maker_type::type  direct_element_type;
+
+    //! \returns  The extent of the next index to be given.
+    size_type  size() const  { return *extents; }
+
+    /** \brief  Access to element data, with depth of exactly one.
+        \pre  `i < size()`.
+        \param i  The index for the next dimension.
+        \returns  A proxy for the remaining dimensions, or the element if this
+                  was the last index needed.
+     */
+    direct_element_type  operator []( size_type i ) const
+    {
+        return maker_type::make( base, offset + i * *strides, extents + 1,
+         strides + 1 );
+    }
+
+    //! Initialize with the owner's container start and the partial state.
+    multiarray_subarray( Iterator b, size_type o, size_type const *e,
+     size_type const *s )
+      : base( b ), offset( o ), extents( e ), strides( s )
+    {}
+
+private:
+    Iterator           base;
+    size_type          offset;
+    size_type const *  extents;
+    size_type const *  strides;
+};
+
+//! Gives definition to the number of remaining indexes.
+template < typename Iterator, typename SizeType, std::size_t Remaining >
+constexpr
+std::size_t  multiarray_subarray<Iterator, SizeType, Remaining>::dimensionality;
+
 }  // namespace detail
 
 
@@ -729,20 +888,31 @@ appropriately.
                        May be zero.
     \tparam Container  The internal container for the elements.  If not given,
                        defaults to `std::vector<Element>`.
+    \tparam IndexType  The type for extents, priorities, strides, and index
+                       coordinates (#index_type).  Has to be an unsigned
+                       integer type.  If not given, defaults to
+                       `Container::size_type`.  A narrower type, like
+                       `std::uint32_t`, shrinks the index tables and the offset
+                       arithmetic; arrays whose element count doesn't fit are
+                       rejected with `std::overflow_error`.  #size_type (and so
+                       #size) stays with `Container::size_type`.
 
  */
 template <
-    typename Element, std::size_t Rank, class Container = std::vector<Element>
+    typename Element, std::size_t Rank, class Container = std::vector<Element>,
+    typename IndexType = typename Container::size_type
 >
 class multiarray
-    : private detail::multiarray_storage_base<Element, Container>
-    , private detail::multiarray_indexed_base<typename Container::size_type,
-      Rank>
+    : private detail::multiarray_storage_base<Element, Container, IndexType>
+    , private detail::multiarray_indexed_base<IndexType, Rank>
 {
+    static_assert( std::is_unsigned<IndexType>::value,
+     "The index type has to be an unsigned integer type" );
+
     // Base types
-    using sbase_type = detail::multiarray_storage_base<Element, Container>;
-    using ibase_type = detail::multiarray_indexed_base<typename
-     Container::size_type, Rank>;
+    using sbase_type = detail::multiarray_storage_base<Element, Container,
+     IndexType>;
+    using ibase_type = detail::multiarray_indexed_base<IndexType, Rank>;
 
 public:
     // Template parameters
@@ -756,7 +926,13 @@ public:
     using typename sbase_type::reference;
     using typename sbase_type::const_reference;
     //! The type for size-based meta-data (`Container::size_type`).
-    typedef typename ibase_type::size_type  size_type;
+    typedef typename sbase_type::size_type   size_type;
+    //! The type for index coordinates and index-based meta-data (IndexType).
+    typedef typename ibase_type::size_type  index_type;
+    //! The type for iterating over elements in memory order.
+    typedef typename container_type::iterator              iterator;
+    //! The type for iterating over elements in memory order, immutable access.
+    typedef typename container_type::const_iterator  const_iterator;
 
     // Lifetime management
     // (Use automatically-defined copy-ctr, move-ctr, and destructor)
@@ -793,6 +969,7 @@ public:
 
     using ibase_type::extents;
     using ibase_type::priorities;
+    using ibase_type::strides;
     using ibase_type::extents_and_priorities;
 
     using ibase_type::use_row_major_order;
@@ -803,6 +980,87 @@ public:
     using sbase_type::at;
     using sbase_type::operator [];
 
+    /** \brief  Access to element data, with depth of exactly one.
+
+    Provides the first step of a chain of `operator []` calls, like a built-in
+    array.  If #dimensionality is 1, then an element is directly returned.
+    Otherwise, a proxy for the remaining dimensions is returned, which can be
+    indexed further.  Therefore `a[i][j][k]` is equivalent to `a(i, j, k)`, and
+    `boost::slice` works on this type.
+
+    The supplied index value is **not** bounds-checked.
+
+        \pre  `dimensionality > 0`.
+        \pre  *i* \< `extents()[ 0 ]`.
+
+        \param i  The index for the first dimension.
+
+        \returns  A reference to the given element, or a proxy for the given
+                  sub-array.
+     */
+    auto  operator []( index_type i ) -> typename
+     detail::multiarray_subarray_maker<typename container_type::iterator,
+     index_type, Rank - 1u>::type
+    {
+        static_assert( dimensionality > 0u, "Can't index a scalar" );
+
+        return detail::multiarray_subarray_maker<typename
+         container_type::iterator, index_type, Rank - 1u>::make( std::begin(c),
+         i * *this->strides_data(), this->extents_data() + 1,
+         this->strides_data() + 1 );
+    }
+    //! \overload
+    auto  operator []( index_type i ) const -> typename
+     detail::multiarray_subarray_maker<typename container_type::const_iterator,
+     index_type, Rank - 1u>::type
+    {
+        static_assert( dimensionality > 0u, "Can't index a scalar" );
+
+        return detail::multiarray_subarray_maker<typename
+         container_type::const_iterator, index_type, Rank - 1u>::make(
+         std::begin(c), i * *this->strides_data(), this->extents_data() + 1,
+         this->strides_data() + 1 );
+    }
+
+    // Iteration
+    /** \brief  Start of the elements, in memory order.
+
+    Together with #end, covers the elements that #apply visits, in the same
+    order, but without computing index coordinates.  That makes the range
+    suitable for whole-array passes with Standard algorithms, when the order
+    elements are visited in doesn't matter (or memory order is wanted).
+
+        \returns  An iterator to the first element.
+     */
+          iterator   begin()        { return std::begin( c ); }
+    //! \overload
+    const_iterator   begin() const  { return std::begin( c ); }
+    //! \returns  `begin() + min(required_size(), size())`.
+          iterator     end()        { return std::next(begin(), limit()); }
+    //! \overload
+    const_iterator     end() const  { return std::next(begin(), limit()); }
+    //! \returns  An immutable-access iterator to the first element.
+    const_iterator  cbegin() const  { return begin(); }
+    //! \returns  An immutable-access iterator past the last visited element.
+    const_iterator    cend() const  { return end(); }
+
+    /** \brief  Direct access to contiguous element storage.
+
+    Only available when #container_type has a `data` member function, which
+    gives a pointer to its element block (like `std::vector` and `std::array`).
+    The first `min(required_size(), size())` elements are the ones in the
+    array, in memory order.
+
+        \returns  `c.data()`.
+     */
+    template < class C = container_type >
+    auto  data() -> decltype( std::declval<C &>().data() )
+    { return c.data(); }
+    //! \overload
+    template < class C = container_type >
+    auto  data() const -> decltype( std::declval<C const &>().data() )
+    { return c.data(); }
+
     // Assignments
     /** \brief    Fill elements with specified value.
         \details  Assigns the given value to all the elements.  If the number of
@@ -814,7 +1072,7 @@ public:
         \post     Each element is equivalent to *v*.
      */
     void  fill( const_reference v )
-    { std::fill_n(std::begin( c ), std::min( required_size(), size() ), v); }
+    { std::fill_n(begin(), limit(), v); }
 
     /** \brief  Swaps states with another object.
 
@@ -823,14 +1081,14 @@ public:
 
         \param other  The object to trade state with.
 
-        \throws  Whatever  the element-, `size_type`-, or container-level swap
-                           throws.
+        \throws  Whatever  the element-, `index_type`-, or container-level
+                           swap throws.
         \post  `*this` is equivalent to the old state of *other*, while that
                object is equivalent to the old state of `*this`.
      */
     void  swap( multiarray &other )
      noexcept( detail::is_swap_nothrow_too<container_type>() &&
-     detail::is_swap_nothrow_too<size_type>() )
+     detail::is_swap_nothrow_too<index_type>() )
     { sbase_type::swap(other); ibase_type::swap(other); }
 
     /** \brief    Calls function on all elements, with indices.
@@ -845,7 +1103,7 @@ public:
                   that will execute the code.  It has to take #dimensionality +
                   1 arguments.  The first argument must be compatible with
                   #value_type (or (immutable) reference of); subsequent
-                  arguments have to be compatible with #size_type.
+                  arguments have to be compatible with #index_type.
         \post     Unspecified, since *f* is allowed to alter the elements (when
                   taking a mutable reference) and/or itself during the calls.
      */
@@ -855,7 +1113,7 @@ public:
         // This is the same as the "const" version, but I can't reuse it using
         // "const_cast" games since the inner calls would still be "const."
 
-        auto  limit = std::min( required_size(), size() );
+        auto  limit = this->limit();
         auto  current = std::begin( c );
         auto  indexes = this->first_index_pack();
 
@@ -869,7 +1127,7 @@ public:
     template < typename Function >
     void  apply( Function &&f ) const
     {
-        auto  limit = std::min( required_size(), size() );
+        auto  limit = this->limit();
         auto  current = std::begin( c );
         auto  indexes = this->first_index_pack();
 
@@ -887,7 +1145,7 @@ public:
                   that will execute the code.  It has to take #dimensionality +
                   1 arguments.  The first argument must be compatible with
                   #value_type (or `const` reference of); subsequent arguments
-                  have to be compatible with #size_type.
+                  have to be compatible with #index_type.
         \post     Unspecified, since *f* may alter itself during the calls.
      */
     template < typename Function >
@@ -898,20 +1156,32 @@ protected:
     using sbase_type::c;
 
 private:
+    // The number of elements that are both needed and present.
+    // (It's no more than required_size(), so it fits in index_type.)
+    index_type  limit() const
+    {
+        return size() < required_size() ? static_cast<index_type>( size() ) :
+         required_size();
+    }
+
     // Set the virtual-array size to match the container's size.
     void  resize_to_fit()
     {
-        size_type const  new_size = dimensionality && !c.empty() ? c.size() : 1;
-        std::array<size_type, dimensionality>  e;
+        if ( c.size() > std::numeric_limits<index_type>::max() )
+            throw std::overflow_error{ "Container too large for index type" };
 
-        std::fill( e.begin(), e.end(), size_type(1) );
+        index_type const  new_size = dimensionality && !c.empty() ? c.size() :
+         1;
+        stats_type        e;
+
+        std::fill( e.begin(), e.end(), index_type(1) );
         if ( !e.empty() )
             e[ 0 ] = new_size;
         extents( e );
     }
 
     // Override to connect the two bases together.
-    size_type  get_offset( size_type const *index_begin, size_type const
+    size_type  get_offset( index_type const *index_begin, index_type const
      *index_end, bool throw_on_bad_input ) const final override
     {
         if ( throw_on_bad_input )
@@ -932,19 +1202,472 @@ same element type, number of dimensions, and container type.
     \param a  The first object to have its state exchanged.
     \param b  The second object to have its state exchanged.
 
-    \see  #multiarray<Element,Rank,Container>::swap(multiarray&)
+    \see  #multiarray<Element,Rank,Container,IndexType>::swap(multiarray&)
 
     \throws Whatever  the element-, index-, and the container-level swaps do.
 
+    \post  `a` is equivalent to the old state of `b`, while `b` is equivalent to
+           the old state of `a`.
+ */
+template < typename T, std::size_t Rank, class Cont, typename Index >
+void  swap( multiarray<T, Rank, Cont, Index> &a, multiarray<T, Rank, Cont, Index>
+ &b ) noexcept( noexcept(a.swap( b )) )
+{ a.swap(b); }
+
+
+//  Circular multi-dimensional array adapter class template definition  ------//
+
+/** \brief  A container adapter to view a multi-dimensional array, with one
+            dimension acting as a ring buffer.
+
+This class template works like #multiarray, except that one dimension, the
+*rotating axis*, is circular.  Logical index 0 along that axis maps to an
+in-memory slab given by #head, and logical indexes past it wrap around.  Sliding
+a window along the rotating axis (e.g. keeping the last *N* frames of data) is
+done with #advance, which only changes #head; no elements are moved.  The
+caller then only has to overwrite the slabs that became the newest ones.
+
+The rotation is folded into the offset computation, so element access costs
+the same as for #multiarray plus a single comparison.
+
+    \pre  `Element` can be used as a container element type.
+    \pre  `Element` is the element type for `Container`.
+    \pre  `Container` should be a sequence-container that supports random-access
+          iterators.  (But it can be any Standard-esque container that supports
+          at least forward iterators.)  It has to have at least the `begin`,
+          `size`, `empty`, and `swap` member functions (plus needed support
+          types and type-aliases), with their expected Standard semantics.
+    \pre  `Rank > 0`.
+
+    \tparam Element    The type of the elements.
+    \tparam Rank       The number of index coordinates to access an element.
+    \tparam Container  The internal container for the elements.  If not given,
+                       defaults to `std::vector<Element>`.
+
+ */
+template <
+    typename Element, std::size_t Rank, class Container = std::vector<Element>
+>
+class ring_multiarray
+    : private detail::multiarray_storage_base<Element, Container>
+    , private detail::multiarray_indexed_base<typename Container::size_type,
+      Rank>
+{
+    static_assert( Rank > 0u, "A ring needs at least one dimension" );
+
+    // Base types
+    using sbase_type = detail::multiarray_storage_base<Element, Container>;
+    using ibase_type = detail::multiarray_indexed_base<typename
+     Container::size_type, Rank>;
+
+public:
+    // Template parameters
+    using sbase_type::value_type;
+    using ibase_type::dimensionality;
+    //! The container type (Container).  Gives access to its template parameter.
+    typedef typename sbase_type::container_type  container_type;
+
+    // Other types
+    using typename ibase_type::stats_type;
+    using typename sbase_type::reference;
+    using typename sbase_type::const_reference;
+    //! The type for size-based meta-data (`Container::size_type`).
+    typedef typename ibase_type::size_type  size_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Default constructor
+        \post  #c is default-initialized.
+        \post  `extents() == {{ cc.empty() ? 1 : cc.size(), 1, ..., 1 }}`.
+        \post  `priorities() == {{ 0, ..., (dimensionality - 1) }}`.
+        \post  `rotating_axis() == 0 && head() == 0`.
+     */
+              ring_multiarray()  : sbase_type(), ibase_type()
+    { resize_to_fit(); }
+    /** \brief  Initialize with a copy of the given container
+        \param cc  The container to copy from.
+        \post  #c is equivalent to `cc`.
+        \post  `extents() == {{ c.empty() ? 1 : c.size(), 1, ..., 1 }}`.
+        \post  `priorities() == {{ 0, ..., (dimensionality - 1) }}`.
+        \post  `rotating_axis() == 0 && head() == 0`.
+     */
+    explicit  ring_multiarray( container_type const &cc )
+      : sbase_type( cc ), ibase_type()
+    { resize_to_fit(); }
+    /** \brief  Initialize from moving in the given container
+        \param cc  The container to move from.
+        \post  #c is equivalent to the pre-move state of `cc`.  The state of
+               `cc` is unspecified.
+        \post  `extents() == {{ cc.empty() ? 1 : cc.size(), 1, ..., 1 }}`.
+        \post  `priorities() == {{ 0, ..., (dimensionality - 1) }}`.
+        \post  `rotating_axis() == 0 && head() == 0`.
+     */
+    explicit  ring_multiarray( container_type &&cc )
+      : sbase_type( std::move(cc) ), ibase_type()
+    { resize_to_fit(); }
+
+    // Status
+    using ibase_type::required_size;
+    using sbase_type::empty;
+    using sbase_type::size;
+
+    using ibase_type::extents;
+    using ibase_type::priorities;
+
+    /** \brief    Sets the extent for each index.
+        \details  Works like the #multiarray version, but also resets the ring.
+        \param e  The array of new extents.
+        \throws std::out_of_range    when any element of `e` is zero.
+        \throws std::overflow_error  when the product of `e`'s elements exceeds
+                                     the limit of `size_type`.
+        \post  `extents() == e && head() == 0`.
+     */
+    void  extents( stats_type const &e )  { ibase_type::extents(e); head_ = 0u; }
+    /** \overload
+        \param e0  The first extent.
+        \param e   The remaining extents.
+        \post  `extents() == {{ e0, e... }} && head() == 0`.
+     */
+    template <
+        typename ...Args,
+        typename         = typename std::enable_if<1 + sizeof...(Args) ==
+         dimensionality>::type
+    >
+    void  extents( size_type e0, Args &&...e )
+    { extents(stats_type{ {e0, std::forward<Args>(e)...} }); }
+    /** \brief    Set the extents and priorities at the same time.
+        \details  Works like the #multiarray version, but also resets the ring.
+        \param e  The new extents for the indexes.
+        \param p  The new index stride priorities.
+        \post  `extents() == e && priorities() == p && head() == 0`.
+     */
+    void  extents_and_priorities( stats_type const &e, stats_type const &p )
+    { ibase_type::extents_and_priorities(e, p); head_ = 0u; }
+    /** \brief    Sets the priority for each index.
+        \details  Works like the #multiarray version, but also resets the ring,
+                  since the slabs are laid out differently afterwards.
+        \param p  The new priorities.
+        \throws std::out_of_range      when any element of `p` matches or
+                                       exceeds #dimensionality.
+        \throws std::invalid_argument  when `p` has a repeated value.
+        \post  `priorities() == p && head() == 0`.
+     */
+    void  priorities( stats_type const &p )
+    { ibase_type::priorities(p); head_ = 0u; }
+    /** \overload
+        \param p0  The first priority.
+        \param p   The remaining priorities.
+        \post  `priorities() == {{ p0, p... }} && head() == 0`.
+     */
+    template <
+        typename ...Args,
+        typename         = typename std::enable_if<1 + sizeof...(Args) ==
+         dimensionality>::type
+    >
+    void  priorities( size_type p0, Args &&...p )
+    { priorities(stats_type{ {p0, std::forward<Args>(p)...} }); }
+
+    //! Sets row-major order, like the #multiarray version, and resets the ring.
+    void  use_row_major_order()
+    { ibase_type::use_row_major_order(); head_ = 0u; }
+    //! Sets column-major order, like the #multiarray version, and resets the
+    //! ring.
+    void  use_column_major_order()
+    { ibase_type::use_column_major_order(); head_ = 0u; }
+
+    // Ring status
+    //! \returns  The dimension that wraps around.
+    size_type  rotating_axis() const  { return axis_; }
+    /** \brief    Sets which dimension wraps around.
+        \details  The ring is reset, so the logical and in-memory positions of
+                  every element match afterwards.
+        \param a  The new rotating axis.
+        \throws std::out_of_range  when `a` isn't less than #dimensionality.
+        \post  `rotating_axis() == a && head() == 0`.
+     */
+    void       rotating_axis( size_type a )
+    {
+        if ( a >= dimensionality )
+            throw std::out_of_range{ "Illegal rotating axis" };
+
+        axis_ = a;
+        head_ = 0u;
+    }
+
+    //! \returns  The in-memory index, along #rotating_axis(), of the slab with
+    //!           logical index 0 (i.e. the oldest one).
+    size_type  head() const  { return head_; }
+
+    /** \brief    Slides the ring forward.
+        \details  Rotates the logical window along #rotating_axis() by `n`
+                  slabs.  The slab previously at logical index `k` moves to
+                  logical index `k - n`, and the `n` oldest slabs reappear at
+                  the end (logical indexes `extent - n` to `extent - 1`) with
+                  their stale values, ready to be overwritten.  No element is
+                  read or written.
+        \param n  The number of slabs to advance.  Defaults to 1.
+        \post  `head()` equals `(old_head + n) % extents()[rotating_axis()]`.
+     */
+    void  advance( size_type n = 1u )
+    { head_ = ( head_ + n % axis_extent() ) % axis_extent(); }
+
+    // Access
+    using sbase_type::operator ();
+    using sbase_type::at;
+    using sbase_type::operator [];
+
+    // Assignments
+    /** \brief    Fill elements with specified value.
+        \details  Assigns the given value to all the elements.  If the number of
+                  stored elements differs from the amount needed, iteration will
+                  stop at the shorter length.
+        \pre      #value_type has to be Assignable.
+        \param v  The value of the assignment source.
+        \throws Whatever  assignment for #value_type throws.
+        \post     Each element is equivalent to *v*.
+     */
+    void  fill( const_reference v )
+    { std::fill_n(std::begin( c ), std::min( required_size(), size() ), v); }
+
+    /** \brief  Swaps states with another object.
+        \param other  The object to trade state with.
+        \throws  Whatever  the element-, `size_type`-, or container-level swap
+                           throws.
+        \post  `*this` is equivalent to the old state of *other*, while that
+               object is equivalent to the old state of `*this`.
+     */
+    void  swap( ring_multiarray &other )
+     noexcept( detail::is_swap_nothrow_too<container_type>() &&
+     detail::is_swap_nothrow_too<size_type>() )
+    {
+        using std::swap;
+
+        sbase_type::swap( other );
+        ibase_type::swap( other );
+        swap( axis_, other.axis_ );
+        swap( head_, other.head_ );
+    }
+
+    /** \brief    Calls function on all elements, with (logical) indices.
+        \details  Loops through all the extant elements in in-memory order,
+                  like #multiarray::apply.  The index coordinates passed to the
+                  function are the logical ones, so they're compatible with
+                  #operator()().
+        \param f  The function, function-pointer, function-object, or lambda
+                  that will execute the code.  It has to take #dimensionality +
+                  1 arguments.  The first argument must be compatible with
+                  #value_type (or (immutable) reference of); subsequent
+                  arguments have to be compatible with #size_type.
+        \post     Unspecified, since *f* is allowed to alter the elements (when
+                  taking a mutable reference) and/or itself during the calls.
+     */
+    template < typename Function >
+    void  apply( Function &&f )
+    {
+        auto  limit = std::min( required_size(), size() );
+        auto  current = std::begin( c );
+        auto  indexes = this->first_index_pack();
+
+        while ( limit-- )
+        {
+            detail::apply_x_and_exploded_tuple( f, *current++, to_logical(
+             indexes) );
+            this->advance_index_pack( indexes );
+        }
+    }
+    //! \overload
+    template < typename Function >
+    void  apply( Function &&f ) const
+    {
+        auto  limit = std::min( required_size(), size() );
+        auto  current = std::begin( c );
+        auto  indexes = this->first_index_pack();
+
+        while ( limit-- )
+        {
+            detail::apply_x_and_exploded_tuple( f, *current++, to_logical(
+             indexes) );
+            this->advance_index_pack( indexes );
+        }
+    }
+    /** \brief    Calls function on all elements, with indices, immutable access
+        \param f  The function, function-pointer, function-object, or lambda
+                  that will execute the code.
+        \see      #apply
+     */
+    template < typename Function >
+    void  capply( Function &&f ) const
+    { apply(std::forward<Function>( f )); }
+
+    /** \brief    Calls function on all elements, in logical order.
+        \details  Like #apply, but the elements are visited in the order their
+                  logical index tuples would have in memory if the ring were
+                  reset; i.e. the oldest slab along #rotating_axis() comes
+                  first.  Elements past the end of the internal container are
+                  skipped.
+        \param f  The function, function-pointer, function-object, or lambda
+                  that will execute the code.  It has the same requirements as
+                  for #apply.
+        \post     Unspecified, since *f* is allowed to alter the elements (when
+                  taking a mutable reference) and/or itself during the calls.
+     */
+    template < typename Function >
+    void  apply_in_order( Function &&f )
+    {
+        auto const  limit = std::min( required_size(), size() );
+        auto        indexes = this->first_index_pack();
+
+        do
+        {
+            auto const  offset = ibase_type::indexes_to_offset( indexes.data(),
+             indexes.data() + dimensionality, axis_, head_ );
+
+            if ( offset < limit )
+                detail::apply_x_and_exploded_tuple( f, *std::next(std::begin(
+                 c ), offset), indexes );
+        } while ( !this->advance_index_pack(indexes) );
+    }
+    //! \overload
+    template < typename Function >
+    void  apply_in_order( Function &&f ) const
+    {
+        auto const  limit = std::min( required_size(), size() );
+        auto        indexes = this->first_index_pack();
+
+        do
+        {
+            auto const  offset = ibase_type::indexes_to_offset( indexes.data(),
+             indexes.data() + dimensionality, axis_, head_ );
+
+            if ( offset < limit )
+                detail::apply_x_and_exploded_tuple( f, *std::next(std::begin(
+                 c ), offset), indexes );
+        } while ( !this->advance_index_pack(indexes) );
+    }
+    /** \brief    Calls function on all elements, in logical order, immutable
+                  access
+        \param f  The function, function-pointer, function-object, or lambda
+                  that will execute the code.
+        \see      #apply_in_order
+     */
+    template < typename Function >
+    void  capply_in_order( Function &&f ) const
+    { apply_in_order(std::forward<Function>( f )); }
+
+protected:
+    using sbase_type::c;
+
+private:
+    // Set the virtual-array size to match the container's size.
+    void  resize_to_fit()
+    {
+        size_type const  new_size = c.empty() ? 1 : c.size();
+        stats_type       e;
+
+        std::fill( e.begin(), e.end(), size_type(1) );
+        e[ 0 ] = new_size;
+        extents( e );
+    }
+
+    // The extent of the rotating axis
+    size_type   axis_extent() const  { return extents()[ axis_ ]; }
+
+    // Convert an in-memory index tuple to its logical counterpart.
+    stats_type  to_logical( stats_type indexes ) const
+    {
+        auto &  i = indexes[ axis_ ];
+
+        i = i >= head_ ? i - head_ : i + ( axis_extent() - head_ );
+        return indexes;
+    }
+
+    // Override to connect the two bases together.
+    size_type  get_offset( size_type const *index_begin, size_type const
+     *index_end, bool throw_on_bad_input ) const final override
+    {
+        if ( throw_on_bad_input )
+            ibase_type::throw_for_bad_indexes( index_begin, index_end );
+
+        return ibase_type::indexes_to_offset( index_begin, index_end, axis_,
+         head_ );
+    }
+
+    // The ring's state
+    size_type  axis_ = 0u, head_ = 0u;
+};
+
+ /** \brief  Swap routine for `ring_multiarray`.
+    \param a  The first object to have its state exchanged.
+    \param b  The second object to have its state exchanged.
+    \see  #ring_multiarray<Element,Rank,Container>::swap(ring_multiarray&)
+    \throws Whatever  the element-, index-, and the container-level swaps do.
     \post  `a` is equivalent to the old state of `b`, while `b` is equivalent to
            the old state of `a`.
  */
 template < typename T, std::size_t Rank, class Cont >
-void  swap( multiarray<T, Rank, Cont> &a, multiarray<T, Rank, Cont> &b )
- noexcept( noexcept(a.swap( b )) )
+void  swap( ring_multiarray<T, Rank, Cont> &a, ring_multiarray<T, Rank, Cont>
+ &b ) noexcept( noexcept(a.swap( b )) )
 { a.swap(b); }
 
 }  // namespace container
+
+
+//  Checked array-chain-indexing function template overloads  ----------------//
+
+/** \brief  Apply `operator []` serially for a list of expressions, with bounds
+            checking, starting from a `multiarray`.
+
+    \details  Works like the general version, except that the first index is
+              checked against `t.extents()[0]` instead of `t.size()`, since the
+              latter is the element count of the internal container.  The
+              remaining indexes are checked by the partial-indexing proxies'
+              `size()`.
+
+    \param e  The exception object thrown if an index violates the array bound.
+    \param t  The base object.
+    \param u  The first index object/value.
+    \param v  Subsequent indexing objects/values.  May be empty.
+
+    \throws  *e*  if bounds-checking reports a violation
+
+    \returns  The result from the last indexing operation.
+ */
+template < typename E, typename T, std::size_t R, class C, typename I,
+ typename U, typename ...V >
+inline
+auto  checked_slice( E &&e, container::multiarray<T, R, C, I> &t, U &&u, V
+ &&...v )
+ -> typename indexing_result<container::multiarray<T, R, C, I> &, U, V...>::type
+{
+    typedef typename std::remove_reference<U>::type  u_type;
+    typedef typename std::common_type<u_type, I>::type  cmp_type;
+
+    if ( (u < u_type{}) || (static_cast<cmp_type>( u ) >= static_cast<cmp_type>(
+     t.extents()[0] )) )
+        throw e;
+    return checked_slice( static_cast<E &&>(e), t[static_cast<U &&>( u )],
+     static_cast<V &&>(v)... );
+}
+
+//! \overload
+template < typename E, typename T, std::size_t R, class C, typename I,
+ typename U, typename ...V >
+inline
+auto  checked_slice( E &&e, container::multiarray<T, R, C, I> const &t, U &&u,
+ V &&...v )
+ -> typename indexing_result<container::multiarray<T, R, C, I> const &, U,
+ V...>::type
+{
+    typedef typename std::remove_reference<U>::type  u_type;
+    typedef typename std::common_type<u_type, I>::type  cmp_type;
+
+    if ( (u < u_type{}) || (static_cast<cmp_type>( u ) >= static_cast<cmp_type>(
+     t.extents()[0] )) )
+        throw e;
+    return checked_slice( static_cast<E &&>(e), t[static_cast<U &&>( u )],
+     static_cast<V &&>(v)... );
+}
+
 }  // namespace boost
 
 
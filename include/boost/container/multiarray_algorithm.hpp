@@ -0,0 +1,1118 @@
+//  Boost Multi-dimensional Array Algorithms header file  --------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  Function templates that process `multiarray` objects a fiber, or
+      block, at a time, spreading the work over several threads.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of function templates that work
+    on the fibers of a `multiarray` (the one-dimensional runs of elements found
+    by varying a single index while the others stay fixed), like sorting,
+    prefix scans, and sliding windows.  The fibers are independent, so they are
+    divided among threads.  Work on fibers is arranged so memory is accessed
+    sequentially, either by processing contiguous fibers in place, gathering
+    strided ones into a per-thread buffer, or sweeping many fibers at once.
+
+    \warning  This library requires C++2011 features, including `std::thread`.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_ALGORITHM_HPP
+#define BOOST_CONTAINER_MULTIARRAY_ALGORITHM_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_ref.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    /** \brief  Run a function over sub-ranges of `[0, n)` on several threads.
+
+    The range is split into one contiguous chunk per thread, and `f( b, e )` is
+    called for each chunk.  The calling thread takes the first chunk.  The
+    first exception thrown by any call is re-thrown after all threads finish.
+
+        \param n        The length of the range.
+        \param threads  The maximum number of threads to use.  Zero means the
+                        number of hardware threads.
+        \param f        The function taking a chunk's bounds.
+     */
+    template < typename Function >
+    void  parallel_chunks( std::size_t n, unsigned threads, Function &&f )
+    {
+        if ( !threads )
+            threads = std::max( std::thread::hardware_concurrency(), 1u );
+        if ( threads > n )
+            threads = static_cast<unsigned>( n );
+        if ( threads <= 1u )
+        {
+            if ( n )
+                f( std::size_t(0), n );
+            return;
+        }
+
+        std::vector<std::exception_ptr>  errors( threads );
+        std::vector<std::thread>         pool;
+        auto const                       chunk = [n, threads]( unsigned t )
+        { return n / threads * t + std::min<std::size_t>( n % threads, t ); };
+        auto const                       run = [&]( unsigned t ) {
+            try
+            {
+                f( chunk(t), chunk(t + 1u) );
+            }
+            catch ( ... )
+            {
+                errors[ t ] = std::current_exception();
+            }
+        };
+
+        pool.reserve( threads - 1u );
+        try
+        {
+            for ( unsigned  t = 1u ; t < threads ; ++t )
+                pool.emplace_back( run, t );
+        }
+        catch ( ... )
+        {
+            for ( auto &t : pool )
+                t.join();
+            throw;
+        }
+        run( 0u );
+        for ( auto &t : pool )
+            t.join();
+        for ( auto const &e : errors )
+            if ( e )
+                std::rethrow_exception( e );
+    }
+
+    //! Below this many elements, automatic thread counts use one thread.
+    constexpr  std::size_t  parallel_grain = 1u << 15;
+
+    //! Choose the thread count for a given amount of work.
+    inline
+    unsigned  thread_count_for( std::size_t work, unsigned threads )
+    { return threads ? threads : work < parallel_grain ? 1u : 0u; }
+
+    /** \brief  Check that an array's container holds all of its elements.
+        \details  A `multiarray` may have a container smaller than its
+                  #multiarray::required_size; the algorithms here access
+                  elements by memory offset, so they refuse such arrays.
+        \throws std::length_error  if `a.size() < a.required_size()`.
+     */
+    template < class MultiArray >
+    void  require_full_size( MultiArray const &a )
+    {
+        if ( a.size() < a.required_size() )
+            throw std::length_error{ "Container smaller than required size" };
+    }
+
+    //! Copy a list of extents or indexes into another index type's list.
+    template < class Stats, typename IndexType, std::size_t Rank >
+    Stats  convert_stats( std::array<IndexType, Rank> const &x )
+    {
+        Stats  result;
+
+        std::copy( x.begin(), x.end(), result.begin() );
+        return result;
+    }
+
+    /** \brief  Locates the fibers of a multi-dimensional array along an axis.
+
+    The fibers are numbered in row-major order of the remaining indexes.  Each
+    fiber has #length elements, #step elements apart in memory.
+     */
+    template < typename SizeType, std::size_t Rank >
+    class multiarray_fibers
+    {
+    public:
+        typedef std::array<SizeType, Rank>  stats_type;
+
+        multiarray_fibers( stats_type const &e, stats_type const &s, SizeType
+         axis )
+          : length( e[axis] ), step( s[axis] ), count( 1u ), sizes( e ),
+            strides( s )
+        {
+            sizes[ axis ] = 1u;
+            for ( auto const x : sizes )
+                count *= x;
+        }
+
+        //! The offset of the first element of fiber `f`.
+        SizeType  offset( SizeType f ) const
+        {
+            SizeType  result = 0u;
+
+            for ( auto  d = Rank ; d-- ; )
+            {
+                result += f % sizes[ d ] * strides[ d ];
+                f /= sizes[ d ];
+            }
+            return result;
+        }
+
+        SizeType  length, step, count;
+
+    private:
+        stats_type  sizes, strides;
+    };
+
+    /** \brief  Apply a range-processing function to every fiber along an axis.
+
+    Contiguous fibers are passed directly.  Strided fibers are copied into a
+    per-thread buffer, processed, and copied back.
+
+        \param a        The array to process.
+        \param axis     The dimension the fibers run along.
+        \param threads  The maximum number of threads; zero means automatic,
+                        by #thread_count_for.
+        \param f        The function, taking a random-access iterator range.
+     */
+    template < typename T, std::size_t Rank, class Container, typename
+     IndexType, typename Function >
+    void  for_each_fiber_range( multiarray<T, Rank, Container, IndexType> &a,
+     typename Container::size_type axis, unsigned threads, Function f )
+    {
+        static_assert( Rank > 0u, "Scalars have no fibers" );
+
+        if ( axis >= Rank )
+            throw std::out_of_range{ "Axis too large" };
+        require_full_size( a );
+
+        multiarray_fibers<IndexType, Rank> const  fibers( a.extents(),
+         a.strides(), axis );
+        auto const  first = a.begin();
+
+        parallel_chunks( fibers.count, thread_count_for(a.required_size(),
+         threads), [&]( std::size_t b, std::size_t
+         e ) {
+            std::vector<T>  scratch;
+
+            if ( fibers.step != 1u )
+                scratch.resize( fibers.length );
+            for ( ; b < e ; ++b )
+            {
+                auto const  start = first + fibers.offset( b );
+
+                if ( fibers.step == 1u )
+                {
+                    f( start, start + fibers.length );
+                    continue;
+                }
+                for ( std::size_t  i = 0u ; i < fibers.length ; ++i )
+                    scratch[ i ] = std::move( start[i * fibers.step] );
+                f( scratch.begin(), scratch.end() );
+                for ( std::size_t  i = 0u ; i < fibers.length ; ++i )
+                    start[ i * fibers.step ] = std::move( scratch[i] );
+            }
+        } );
+    }
+
+    //! Sorts a fiber's range (contiguous or buffered).
+    template < class Compare >
+    struct fiber_sorter
+    {
+        Compare  comp;
+
+        template < typename RandomIt >
+        void  operator ()( RandomIt b, RandomIt e ) const
+        { std::sort(b, e, comp); }
+    };
+
+    //! Partitions a fiber's range around an index.
+    template < class Compare >
+    struct fiber_partitioner
+    {
+        Compare      comp;
+        std::size_t  k;
+
+        template < typename RandomIt >
+        void  operator ()( RandomIt b, RandomIt e ) const
+        { std::nth_element(b, b + k, e, comp); }
+    };
+
+    /** \brief  Splits a dense array into blocks around an axis.
+
+    Since a `multiarray` is dense, the dimensions with smaller strides than
+    `axis` form a contiguous block of #width elements, and those with larger
+    strides repeat the `axis`-by-block slab #outer times.  The element with
+    outer index `o`, axis index `i`, and block index `j` is at offset
+    `(o * length + i) * width + j`.  A "column" is a fixed `(o, j)` pair; there
+    are `outer * width` of them, numbered `o * width + j`.
+     */
+    template < typename SizeType >
+    struct multiarray_axis_blocks
+    {
+        template < class MultiArray >
+        multiarray_axis_blocks( MultiArray const &a, SizeType axis )
+          : length( a.extents()[axis] ), width( a.strides()[axis] ),
+            outer( a.required_size() / (length * width) )
+        {}
+
+        SizeType  length, width, outer;
+
+        /** \brief  Run a function over a range of columns, a slab at a time.
+            \details  Calls `f( o, jb, je )` for each outer index `o` whose
+                      columns intersect `[b, e)`, with `[jb, je)` being the
+                      block indexes of the intersection.
+         */
+        template < typename Function >
+        void  for_columns( SizeType b, SizeType e, Function &&f ) const
+        {
+            for ( auto  o = b / width ; b < e ; ++o )
+            {
+                auto const  stop = std::min<SizeType>( e, (o + 1u) * width );
+
+                f( o, b - o * width, stop - o * width );
+                b = stop;
+            }
+        }
+    };
+
+    //! The number of contiguous fibers the scans interleave at a time.
+    constexpr  std::size_t  scan_batch = 16u;
+    //! The number of elements per fiber of a batch that are buffered at once.
+    constexpr  std::size_t  scan_rows = 256u;
+
+    /** \brief  Run a block scan across contiguous fibers, a batch at a time.
+
+    Fiber `k` of `[b, e)` has `length` elements, starting at `first + k *
+    length`.  Scanning them one by one has a loop-carried dependency, so up to
+    #scan_batch fibers are transposed into a buffer instead, where element `i`
+    of each fiber is adjacent to element `i` of the next.  Calls `f( tile, rows,
+    n, fresh )` to scan the `rows` rows, of `n` elements each, of a tile;
+    `fresh` is set for a batch's first tile.  Long fibers are split into tiles
+    of #scan_rows rows, so `f` has to carry its running values between calls.
+    The tile is then copied back.
+     */
+    template < typename RandomIt, typename Function >
+    void  for_fiber_batches( RandomIt first, std::size_t length, std::size_t
+     b, std::size_t e, Function &&f )
+    {
+        std::vector<typename std::iterator_traits<RandomIt>::value_type>  tile;
+
+        tile.reserve( scan_batch * std::min(scan_rows, length) );
+        for ( ; b < e ; b += scan_batch )
+        {
+            auto const  n = std::min( scan_batch, e - b );
+            auto const  fibers = first + b * length;
+
+            for ( std::size_t  r = 0u ; r < length ; r += scan_rows )
+            {
+                auto const  rows = std::min( scan_rows, length - r );
+
+                tile.clear();
+                for ( std::size_t  i = r ; i < r + rows ; ++i )
+                    for ( std::size_t  k = 0u ; k < n ; ++k )
+                        tile.push_back( std::move(fibers[ k * length + i ]) );
+                f( tile.begin(), rows, n, !r );
+                for ( std::size_t  i = r ; i < r + rows ; ++i )
+                    for ( std::size_t  k = 0u ; k < n ; ++k )
+                        fibers[ k * length + i ] = std::move( tile[(i - r) * n
+                         + k] );
+            }
+        }
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Tile view class template definition  -------------------------------------//
+
+/** \brief  A view of a rectangular block of a multi-dimensional array.
+
+Objects of this type are given to the function passed to #for_each_tile.  The
+view does not own the elements; it is only valid while the viewed array's
+elements and shape stay the same.  Indexes are relative to the tile's #origin.
+
+    \tparam Iterator  The random-access iterator type of the viewed elements.
+    \tparam SizeType  The type for extents and indexes.
+    \tparam Rank      The number of index coordinates to locate an element.
+ */
+template < typename Iterator, typename SizeType, std::size_t Rank >
+class multiarray_tile
+{
+public:
+    // Template parameters
+    //! The number of extents.  Gives access to its template parameter.
+    static constexpr  std::size_t  dimensionality = Rank;
+    //! The iterator type.  Gives access to its template parameter.
+    typedef Iterator                                           iterator;
+    //! The type for size-based meta-data.
+    typedef SizeType                                           size_type;
+
+    // Other types
+    //! The type for referring to an element.
+    typedef typename std::iterator_traits<Iterator>::reference  reference;
+    //! The type for lists of extents and indexes.
+    typedef std::array<size_type, Rank>                        stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  View a block of elements.
+        \param first   Points to the element at the tile's origin.
+        \param origin  The index coordinates, in the whole array, of the
+                       tile's first element.
+        \param e       The extents of the tile.
+        \param s       The strides of the whole array.
+        \param p       The index priorities of the whole array.
+     */
+    multiarray_tile( iterator first, stats_type const &origin, stats_type const
+     &e, stats_type const &s, stats_type const &p )
+      : start( first ), corner( origin ), sizes( e ), steps( s ), order( p )
+    {}
+
+    // Observers
+    //! \returns  The index coordinates, in the whole array, of the tile's
+    //!           first element.
+    stats_type  origin() const  { return corner; }
+    //! \returns  The extents of the tile.  Tiles at the far edges of the array
+    //!           may be smaller than the others.
+    stats_type  extents() const  { return sizes; }
+    //! \returns  The number of elements in the tile.
+    size_type      size() const
+    {
+        return std::accumulate( sizes.begin(), sizes.end(), size_type(1),
+         std::multiplies<size_type>{} );
+    }
+
+    // Access
+    /** \brief  Access an element, unchecked.
+        \pre  Each index is less than the corresponding tile extent.
+        \param i  The indexes, relative to #origin.
+        \returns  A reference to the element.
+     */
+    template < typename ...Indices >
+    reference  operator ()( Indices ...i ) const
+    {
+        static_assert( sizeof...(Indices) == Rank, "Wrong index count" );
+
+        size_type const  list[] = { 0u, static_cast<size_type>(i)... };
+
+        return start[ std::inner_product(list + 1, list + 1 + Rank,
+         steps.begin(), size_type(0)) ];
+    }
+
+    /** \brief  Calls function on all elements of the tile, with indices.
+        \details  Visits the elements in the order they're laid out in memory,
+                  like #multiarray::apply.  The indices passed after each
+                  element are relative to #origin.
+        \param f  The function.  It has to take #dimensionality + 1 arguments:
+                  an element, then its indexes.
+     */
+    template < typename Function >
+    void  apply( Function &&f ) const
+    {
+        stats_type  indexes{};
+        size_type   offset = 0u;
+
+        for ( auto  n = size() ; n-- ; )
+        {
+            detail::apply_x_and_exploded_tuple( f, start[offset], indexes );
+            for ( auto  k = Rank ; k-- ; )
+            {
+                auto const  d = order[ k ];
+
+                if ( ++indexes[d] < sizes[d] )
+                {
+                    offset += steps[ d ];
+                    break;
+                }
+                offset -= ( sizes[d] - 1u ) * steps[ d ];
+                indexes[ d ] = 0u;
+            }
+        }
+    }
+
+private:
+    iterator    start;
+    stats_type  corner, sizes, steps, order;
+};
+
+//! Gives definition to the number of extents.
+template < typename Iterator, typename SizeType, std::size_t Rank >
+constexpr
+std::size_t  multiarray_tile<Iterator, SizeType, Rank>::dimensionality;
+
+
+//  Sorting function template definitions  -----------------------------------//
+
+/** \brief  Sort each fiber along an axis.
+
+For every combination of the other indexes, sorts the elements found by varying
+the index for dimension `axis`.  Fibers are divided among threads.  Fibers that
+are contiguous under the current #multiarray::priorities (i.e. `axis` has the
+least priority) are sorted in place; others go through a per-thread buffer.
+
+    \pre  `Container` has random-access iterators.
+
+    \param a        The array to sort.
+    \param axis     The dimension to sort along.
+    \param comp     The strict weak ordering for the elements.
+    \param threads  The maximum number of threads to use.  If zero (the
+                    default), uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::out_of_range  if `axis` is not less than `Rank`.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  the comparison, element moves, or thread creation throw.
+
+    \post  `a( ..., i, ... )` is not less than `a( ..., i - 1, ... )` for each
+           `0 < i < a.extents()[ axis ]`, the varying index being in position
+           `axis`.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Compare >
+void  sort_along( multiarray<T, Rank, Container, IndexType> &a, typename
+ Container::size_type axis, Compare comp, unsigned threads = 0u )
+{
+    detail::for_each_fiber_range( a, axis, threads,
+     detail::fiber_sorter<Compare>{comp} );
+}
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+void  sort_along( multiarray<T, Rank, Container, IndexType> &a, typename
+ Container::size_type axis )
+{ sort_along(a, axis, std::less<T>{}); }
+
+/** \brief  Partially sort each fiber along an axis around its `k`-th element.
+
+For every combination of the other indexes, rearranges the elements found by
+varying the index for dimension `axis` so that the element at index `k` is the
+one that would be there if the fiber were sorted, no earlier element is greater
+than it, and no later element is less than it.  Fibers are divided among
+threads, as with #sort_along.
+
+    \pre  `Container` has random-access iterators.
+
+    \param a        The array to partition.
+    \param axis     The dimension to partition along.
+    \param k        The index, along `axis`, of the element to place.
+    \param comp     The strict weak ordering for the elements.
+    \param threads  The maximum number of threads to use.  If zero (the
+                    default), uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::out_of_range  if `axis` is not less than `Rank`, or `k` is not
+                               less than `a.extents()[ axis ]`.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  the comparison, element moves, or thread creation throw.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Compare >
+void  nth_element_along( multiarray<T, Rank, Container, IndexType> &a, typename
+ Container::size_type axis, typename Container::size_type k, Compare comp,
+ unsigned threads = 0u )
+{
+    if ( axis < Rank && k >= a.extents()[axis] )
+        throw std::out_of_range{ "Partition index too large" };
+
+    detail::for_each_fiber_range( a, axis, threads,
+     detail::fiber_partitioner<Compare>{comp, k} );
+}
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+void  nth_element_along( multiarray<T, Rank, Container, IndexType> &a, typename
+ Container::size_type axis, typename Container::size_type k )
+{ nth_element_along(a, axis, k, std::less<T>{}); }
+
+
+//  Scanning function template definitions  ----------------------------------//
+
+/** \brief  Replace each element with the reduction of itself and the elements
+            before it along an axis.
+
+For every combination of the other indexes, computes an inclusive prefix scan
+of the elements found by varying the index for dimension `axis`.  With the
+default operation, that is a cumulative sum.
+
+The scan sweeps whole slabs at a time.  Each step combines a contiguous block
+of elements with the block before it, so memory is read and written
+sequentially and the inner loop can be vectorized by the compiler.  When
+`axis` has the least priority, the blocks would be single elements, so each
+fiber would be scanned serially; instead, batches of fibers are transposed
+through a small per-thread buffer and the same block loop runs across them.
+The columns are divided among threads.
+
+    \pre  `Container` has random-access iterators.
+    \pre  `op` is associative.
+
+    \param a        The array to scan.
+    \param axis     The dimension to scan along.
+    \param op       The binary operation, called as `op( earlier, later )`.
+    \param threads  The maximum number of threads to use.  If zero (the
+                    default), uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::out_of_range  if `axis` is not less than `Rank`.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  the operation, element assignment, or thread creation
+                      throw.
+
+    \post  `a( ..., i, ... )` is the reduction, with `op`, of the old values of
+           `a( ..., 0, ... )` through `a( ..., i, ... )`, the varying index
+           being in position `axis`.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class BinaryOp >
+void  inclusive_scan_along( multiarray<T, Rank, Container, IndexType> &a,
+ typename Container::size_type axis, BinaryOp op, unsigned threads = 0u )
+{
+    static_assert( Rank > 0u, "Scalars have no axes" );
+
+    if ( axis >= Rank )
+        throw std::out_of_range{ "Axis too large" };
+    detail::require_full_size( a );
+
+    detail::multiarray_axis_blocks<IndexType> const  blocks( a, axis );
+    auto const  first = a.begin();
+    auto const  slab = blocks.length * blocks.width;
+
+    detail::parallel_chunks( blocks.outer * blocks.width,
+     detail::thread_count_for(a.required_size(), threads), [&]( std::size_t b,
+     std::size_t e ){
+        if ( blocks.width == 1u )
+        {
+            typedef typename std::vector<T>::iterator  tile_iterator;
+
+            std::vector<T>  last;
+
+            detail::for_fiber_batches( first, blocks.length, b, e, [&](
+             tile_iterator tile, std::size_t rows, std::size_t n, bool fresh ){
+                auto  previous = fresh ? tile : last.begin();
+
+                for ( std::size_t  i = fresh ; i < rows ; ++i )
+                {
+                    auto const  current = tile + i * n;
+
+                    for ( std::size_t  j = 0u ; j < n ; ++j )
+                        current[ j ] = op( previous[j], current[j] );
+                    previous = current;
+                }
+                last.assign( tile + (rows - 1u) * n, tile + rows * n );
+            } );
+            return;
+        }
+
+        blocks.for_columns( b, e, [&]( std::size_t o, std::size_t jb,
+         std::size_t je ){
+            auto  previous = first + o * slab;
+
+            for ( std::size_t  i = 1u ; i < blocks.length ; ++i )
+            {
+                auto const  current = previous + blocks.width;
+
+                for ( auto  j = jb ; j < je ; ++j )
+                    current[ j ] = op( previous[j], current[j] );
+                previous = current;
+            }
+        } );
+    } );
+}
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+void  inclusive_scan_along( multiarray<T, Rank, Container, IndexType> &a,
+ typename Container::size_type axis )
+{ inclusive_scan_along(a, axis, std::plus<T>{}); }
+
+/** \brief  Replace each element with the reduction of an initial value and the
+            elements before it along an axis.
+
+For every combination of the other indexes, computes an exclusive prefix scan
+of the elements found by varying the index for dimension `axis`; the first
+element of each fiber becomes `init`.  The sweep, the batching of fibers along
+the least-priority axis, and the threading are the same as
+#inclusive_scan_along, with a per-thread buffer for the running values of the
+block being scanned.
+
+    \pre  `Container` has random-access iterators.
+    \pre  `op` is associative.
+
+    \param a        The array to scan.
+    \param axis     The dimension to scan along.
+    \param init     The value starting each fiber's reduction.
+    \param op       The binary operation, called as `op( earlier, later )`.
+    \param threads  The maximum number of threads to use.  If zero (the
+                    default), uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::out_of_range  if `axis` is not less than `Rank`.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  the operation, element assignment, or thread creation
+                      throw.
+
+    \post  `a( ..., 0, ... ) == init`, and `a( ..., i, ... )` is the reduction,
+           with `op`, of `init` and the old values of `a( ..., 0, ... )`
+           through `a( ..., i - 1, ... )`, the varying index being in position
+           `axis`.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class BinaryOp >
+void  exclusive_scan_along( multiarray<T, Rank, Container, IndexType> &a,
+ typename Container::size_type axis, T const &init, BinaryOp op, unsigned
+ threads = 0u )
+{
+    static_assert( Rank > 0u, "Scalars have no axes" );
+
+    if ( axis >= Rank )
+        throw std::out_of_range{ "Axis too large" };
+    detail::require_full_size( a );
+
+    detail::multiarray_axis_blocks<IndexType> const  blocks( a, axis );
+    auto const  first = a.begin();
+    auto const  slab = blocks.length * blocks.width;
+
+    detail::parallel_chunks( blocks.outer * blocks.width,
+     detail::thread_count_for(a.required_size(), threads), [&]( std::size_t b,
+     std::size_t e ){
+        std::vector<T>  sums;
+
+        if ( blocks.width == 1u )
+        {
+            typedef typename std::vector<T>::iterator  tile_iterator;
+
+            detail::for_fiber_batches( first, blocks.length, b, e, [&](
+             tile_iterator tile, std::size_t rows, std::size_t n, bool fresh ){
+                if ( fresh )
+                    sums.assign( n, init );
+                for ( std::size_t  i = 0u ; i < rows ; ++i, tile += n )
+                    for ( std::size_t  j = 0u ; j < n ; ++j )
+                    {
+                        T  t = std::move( tile[j] );
+
+                        tile[ j ] = sums[ j ];
+                        sums[ j ] = op( sums[j], std::move(t) );
+                    }
+            } );
+            return;
+        }
+
+        blocks.for_columns( b, e, [&]( std::size_t o, std::size_t jb,
+         std::size_t je ){
+            auto  current = first + o * slab;
+
+            sums.assign( je - jb, init );
+            for ( std::size_t  i = 0u ; i < blocks.length ; ++i )
+            {
+                for ( auto  j = jb ; j < je ; ++j )
+                {
+                    T  t = std::move( current[j] );
+
+                    current[ j ] = sums[ j - jb ];
+                    sums[ j - jb ] = op( sums[j - jb], std::move(t) );
+                }
+                current += blocks.width;
+            }
+        } );
+    } );
+}
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+void  exclusive_scan_along( multiarray<T, Rank, Container, IndexType> &a,
+ typename Container::size_type axis, T const &init )
+{ exclusive_scan_along(a, axis, init, std::plus<T>{}); }
+
+/** \brief  Inclusive scan of an `array_md` along an axis.
+    \details  Views `a` with #make_multiarray_ref, then calls the `multiarray`
+              version.
+    \see  #inclusive_scan_along(multiarray<T,Rank,Container,IndexType>&,typename Container::size_type,BinaryOp,unsigned)
+ */
+template < typename T, std::size_t ...N, class BinaryOp >
+inline
+void  inclusive_scan_along( array_md<T, N...> &a, std::size_t axis, BinaryOp
+ op, unsigned threads = 0u )
+{
+    auto  v = make_multiarray_ref( a );
+
+    inclusive_scan_along( v, axis, op, threads );
+}
+
+//! \overload
+template < typename T, std::size_t ...N >
+inline
+void  inclusive_scan_along( array_md<T, N...> &a, std::size_t axis )
+{ inclusive_scan_along(a, axis, std::plus<T>{}); }
+
+/** \brief  Exclusive scan of an `array_md` along an axis.
+    \details  Views `a` with #make_multiarray_ref, then calls the `multiarray`
+              version.
+    \see  #exclusive_scan_along(multiarray<T,Rank,Container,IndexType>&,typename Container::size_type,T const&,BinaryOp,unsigned)
+ */
+template < typename T, std::size_t ...N, class BinaryOp >
+inline
+void  exclusive_scan_along( array_md<T, N...> &a, std::size_t axis, T const
+ &init, BinaryOp op, unsigned threads = 0u )
+{
+    auto  v = make_multiarray_ref( a );
+
+    exclusive_scan_along( v, axis, init, op, threads );
+}
+
+//! \overload
+template < typename T, std::size_t ...N >
+inline
+void  exclusive_scan_along( array_md<T, N...> &a, std::size_t axis, T const
+ &init )
+{ exclusive_scan_along(a, axis, init, std::plus<T>{}); }
+
+
+//  Rolling window function template definitions  ----------------------------//
+
+/** \brief  The aggregates #rolling_along can compute.
+ */
+enum class rolling_op
+{
+    //! The sum of the window's elements.
+    sum,
+    //! The sum of the window's elements, divided by their count.
+    mean,
+    //! The least of the window's elements.
+    min,
+    //! The greatest of the window's elements.
+    max
+};
+
+//! \cond
+namespace detail
+{
+    //! The most columns a thread sweeps at once, bounding its scratch space.
+    constexpr  std::size_t  rolling_columns = 256u;
+
+    /** \brief  Compute trailing-window aggregates of every fiber along an axis.
+
+    Sums keep a running total per column, adding the element entering the
+    window and subtracting the one leaving it.  Minimums and maximums use the
+    van Herk/Gil-Werman method: the fiber is cut into window-sized pieces, and
+    each window is the combination of a suffix of one piece and a prefix of the
+    next.  Both methods take constant work per element and sweep whole rows of
+    columns, so memory access stays sequential for every axis.
+
+        \param in       The first element of the source.
+        \param out      The first element of the result, laid out like the
+                        source.
+        \param blocks   The source's split around the axis.
+        \param window   The window length, at least one.
+        \param op       The aggregate.
+        \param threads  The thread count to pass to #parallel_chunks.
+     */
+    template < typename T, typename InIterator, typename OutIterator, typename
+     SizeType >
+    void  rolling_impl( InIterator in, OutIterator out,
+     multiarray_axis_blocks<SizeType> const &blocks, std::size_t window,
+     rolling_op op, unsigned threads )
+    {
+        auto const  slab = blocks.length * blocks.width;
+        auto const  pick = [op]( T const &x, T const &y ) -> T const & {
+            return ( op == rolling_op::min ? y < x : x < y ) ? y : x; };
+
+        parallel_chunks( blocks.outer * blocks.width, threads, [&]( std::size_t
+         b, std::size_t e ){
+            std::vector<T>  scratch;
+
+            blocks.for_columns( b, e, [&]( std::size_t o, std::size_t jb,
+             std::size_t je ){
+                for ( ; jb < je ; jb += rolling_columns )
+                {
+                    auto const  cols = std::min( je - jb, rolling_columns );
+                    auto const  src = in + o * slab + jb;
+                    auto const  dst = out + o * slab + jb;
+                    auto const  w = blocks.width;
+
+                    if ( op == rolling_op::sum || op == rolling_op::mean )
+                    {
+                        scratch.assign( cols, T() );
+                        for ( std::size_t  i = 0u ; i < blocks.length ; ++i )
+                        {
+                            auto const  count = std::min<std::size_t>( i + 1u,
+                             window );
+
+                            for ( std::size_t  j = 0u ; j < cols ; ++j )
+                            {
+                                scratch[ j ] = scratch[ j ] + src[ i * w + j ];
+                                if ( i >= window )
+                                    scratch[ j ] = scratch[ j ] - src[ (i -
+                                     window) * w + j ];
+                                dst[ i * w + j ] = op == rolling_op::sum ?
+                                 scratch[ j ] : scratch[ j ] / T( count );
+                            }
+                        }
+                        continue;
+                    }
+
+                    // Prefixes of each piece go straight to the result; the
+                    // suffixes go to scratch.
+                    scratch.resize( blocks.length * cols );
+                    for ( std::size_t  i = 0u ; i < blocks.length ; ++i )
+                        for ( std::size_t  j = 0u ; j < cols ; ++j )
+                            dst[ i * w + j ] = i % window ? pick( dst[(i - 1u) *
+                             w + j], src[i * w + j] ) : src[ i * w + j ];
+                    for ( auto  i = blocks.length ; i-- ; )
+                        for ( std::size_t  j = 0u ; j < cols ; ++j )
+                            scratch[ i * cols + j ] = i + 1u == blocks.length ||
+                             (i + 1u) % window == 0u ? src[ i * w + j ] : pick(
+                             src[i * w + j], scratch[(i + 1u) * cols + j] );
+                    for ( auto  i = window ; i < blocks.length ; ++i )
+                        for ( std::size_t  j = 0u ; j < cols ; ++j )
+                            dst[ i * w + j ] = pick( scratch[(i + 1u - window) *
+                             cols + j], dst[i * w + j] );
+                }
+            } );
+        } );
+    }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Aggregate a sliding window along an axis.
+
+For every combination of the other indexes, and every index `i` along dimension
+`axis`, combines the elements at indexes `i - window + 1` through `i` along that
+axis.  Windows near the start of a fiber are cut short, so the result has the
+same extents as the source.  Each aggregate takes constant time, independent of
+`window`.  As with #inclusive_scan_along, whole slabs are swept at a time, so
+memory is accessed sequentially whichever axis is chosen, and the columns are
+divided among threads.
+
+    \pre  `Container` has random-access iterators.
+    \pre  `T` is Default-Constructible with a zero value.  It supports `+` and
+          `-` for sums, also division by a `T` converted from an integer for
+          means, and `<` for minimums and maximums.
+
+    \param a        The source array.
+    \param axis     The dimension the windows run along.
+    \param window   The number of elements in a full window.
+    \param op       The aggregate to compute.
+    \param threads  The maximum number of threads to use.  If zero (the
+                    default), uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::out_of_range  if `axis` is not less than `Rank`.
+    \throws std::invalid_argument  if `window` is zero.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  the element operations, memory allocation, or thread
+                      creation throw.
+
+    \returns  An array with the same extents, priorities, and index type as
+              `a`, with each element being the aggregate of the window ending
+              there.  Means divide by the window's actual length.  Sums are
+              kept running, so floating-point results may differ slightly from
+              summing each window separately.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+multiarray<T, Rank, std::vector<T>, IndexType>  rolling_along( multiarray<T,
+ Rank, Container, IndexType> const &a, typename Container::size_type axis,
+ typename Container::size_type window, rolling_op op, unsigned threads = 0u )
+{
+    static_assert( Rank > 0u, "Scalars have no axes" );
+
+    if ( axis >= Rank )
+        throw std::out_of_range{ "Axis too large" };
+    if ( !window )
+        throw std::invalid_argument{ "Zero-length window" };
+    detail::require_full_size( a );
+
+    multiarray<T, Rank, std::vector<T>, IndexType>  result( std::vector<T>(
+     a.required_size()) );
+
+    result.extents_and_priorities( a.extents(), a.priorities() );
+    detail::rolling_impl<T>( a.begin(), result.begin(),
+     detail::multiarray_axis_blocks<IndexType>(a, axis), window, op,
+     detail::thread_count_for(a.required_size(), threads) );
+    return result;
+}
+
+/** \brief  Aggregate a sliding window along an axis of an `array_md`.
+    \details  Views `a` and the result with #make_multiarray_ref, then works
+              like the `multiarray` version.
+    \see  #rolling_along(multiarray<T,Rank,Container,IndexType> const&,typename Container::size_type,typename Container::size_type,rolling_op,unsigned)
+ */
+template < typename T, std::size_t ...N >
+array_md<T, N...>  rolling_along( array_md<T, N...> const &a, std::size_t axis,
+ std::size_t window, rolling_op op, unsigned threads = 0u )
+{
+    static_assert( sizeof...(N) > 0u, "Scalars have no axes" );
+
+    if ( axis >= sizeof...(N) )
+        throw std::out_of_range{ "Axis too large" };
+    if ( !window )
+        throw std::invalid_argument{ "Zero-length window" };
+
+    array_md<T, N...>  result;
+    auto const         v = make_multiarray_ref( a );
+
+    detail::rolling_impl<T>( v.begin(), make_multiarray_ref(result).begin(),
+     detail::multiarray_axis_blocks<std::size_t>(v, axis), window, op,
+     detail::thread_count_for(v.required_size(), threads) );
+    return result;
+}
+
+
+//  Tiling function template definitions  ------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Implementation of #for_each_tile, for mutable and immutable access.
+    template < class MultiArray, typename Iterator, typename Function >
+    void  for_each_tile_impl( MultiArray &a, Iterator first, typename
+     MultiArray::stats_type const &tile, Function &&f, unsigned threads )
+    {
+        typedef typename MultiArray::index_type  size_type;
+        typedef typename MultiArray::stats_type  stats_type;
+        typedef multiarray_tile<Iterator, size_type, MultiArray::dimensionality>
+          tile_type;
+
+        static_assert( MultiArray::dimensionality > 0u, "Can't tile a scalar"
+         );
+
+        auto const  e = a.extents(), s = a.strides(), p = a.priorities();
+        stats_type  grid;
+        size_type   count = 1u;
+
+        for ( size_type  d = 0u ; d < e.size() ; ++d )
+        {
+            if ( !tile[d] )
+                throw std::out_of_range{ "Zero tile extent" };
+            count *= grid[ d ] = e[ d ] / tile[ d ] + !!( e[d] % tile[d] );
+        }
+        require_full_size( a );
+
+        parallel_chunks( count, thread_count_for(a.required_size(), threads),
+         [&]( std::size_t b, std::size_t stop ){
+            for ( ; b < stop ; ++b )
+            {
+                stats_type  origin, extents;
+                size_type   offset = 0u, n = b;
+
+                // Tiles are numbered in the array's memory order.
+                for ( auto  k = e.size() ; k-- ; )
+                {
+                    auto const  d = p[ k ];
+
+                    origin[ d ] = n % grid[ d ] * tile[ d ];
+                    n /= grid[ d ];
+                    extents[ d ] = std::min( tile[d], e[d] - origin[d] );
+                    offset += origin[ d ] * s[ d ];
+                }
+                f( tile_type(first + offset, origin, extents, s, p) );
+            }
+        } );
+    }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Calls a function on each tile of an array.
+
+Splits the array into blocks of the given extents and calls `f` with a
+#multiarray_tile view of each.  Blocks along the far edges are cut short to
+fit.  The tiles are visited in the array's memory order, as given by its
+#multiarray::priorities, so consecutive tiles are near each other in memory.
+By default every call of `f` happens on the calling thread.  With more threads,
+contiguous runs of tiles are divided among them, and then `f` has to be safe to
+call concurrently on different tiles.
+
+    \pre  `Container` has random-access iterators.
+
+    \param a        The array to tile.
+    \param tile     The extents of each (full-sized) tile.
+    \param f        The function, taking a #multiarray_tile.
+    \param threads  The maximum number of threads to use.  Defaults to one.
+                    If zero, uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::out_of_range  if any tile extent is zero.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `f` or thread creation throws.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ typename Function >
+inline
+void  for_each_tile( multiarray<T, Rank, Container, IndexType> &a, typename
+ multiarray<T, Rank, Container, IndexType>::stats_type const &tile, Function
+ &&f, unsigned threads = 1u )
+{ detail::for_each_tile_impl(a, a.begin(), tile, std::forward<Function>( f ),
+ threads); }
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ typename Function >
+inline
+void  for_each_tile( multiarray<T, Rank, Container, IndexType> const &a,
+ typename multiarray<T, Rank, Container, IndexType>::stats_type const &tile,
+ Function &&f, unsigned threads = 1u )
+{ detail::for_each_tile_impl(a, a.begin(), tile, std::forward<Function>( f ),
+ threads); }
+
+/** \overload
+    \details  Views `a` with #make_multiarray_ref, then calls the `multiarray`
+              version.
+ */
+template < typename T, std::size_t ...N, typename Function >
+inline
+void  for_each_tile( array_md<T, N...> &a, std::array<std::size_t,
+ sizeof...(N)> const &tile, Function &&f, unsigned threads = 1u )
+{
+    auto  v = make_multiarray_ref( a );
+
+    for_each_tile( v, tile, std::forward<Function>(f), threads );
+}
+
+//! \overload
+template < typename T, std::size_t ...N, typename Function >
+inline
+void  for_each_tile( array_md<T, N...> const &a, std::array<std::size_t,
+ sizeof...(N)> const &tile, Function &&f, unsigned threads = 1u )
+{
+    auto const  v = make_multiarray_ref( a );
+
+    for_each_tile( v, tile, std::forward<Function>(f), threads );
+}
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_ALGORITHM_HPP
@@ -0,0 +1,364 @@
+//  Boost Multi-dimensional Array Contraction header file  -------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A function template that multiplies two `multiarray` objects and
+      sums over shared axes, as directed by axis labels.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a function template for
+    Einstein-summation style tensor contractions, like matrix products, batched
+    matrix products, tensor-times-matrix, outer products, and traces.  Each
+    contraction is recast as a batch of matrix products over groups of axes,
+    and those are computed with a blocked kernel working on packed copies of
+    the operands, spread over several threads.
+
+    \warning  This library requires C++2011 features, including `std::thread`.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_CONTRACTION_HPP
+#define BOOST_CONTAINER_MULTIARRAY_CONTRACTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! An axis label's extent and its stride in each array (zero if absent).
+    struct contraction_axis
+    {
+        std::size_t  extent, a, b, c;
+    };
+
+    /** \brief  A set of axes that act as one dimension of a matrix product.
+
+    The axes are ordered so those with the largest strides vary slowest.  A
+    linear index into the group is row-major over its axes, and #offsets turns
+    all of them into memory offsets for one of the arrays.
+     */
+    struct contraction_group
+    {
+        std::vector<contraction_axis>  axes;
+
+        std::size_t  size() const
+        {
+            std::size_t  result = 1u;
+
+            for ( auto const &x : axes )
+                result *= x.extent;
+            return result;
+        }
+
+        void  arrange()
+        {
+            std::stable_sort( axes.begin(), axes.end(), [](contraction_axis
+             const &x, contraction_axis const &y){ return x.a + x.b + x.c > y.a
+             + y.b + y.c; } );
+        }
+
+        std::vector<std::size_t>  offsets( std::size_t contraction_axis::*stride
+         ) const
+        {
+            std::vector<std::size_t>  result( 1u, 0u );
+
+            result.reserve( size() );
+            for ( auto const &x : axes )
+            {
+                std::vector<std::size_t>  next;
+
+                next.reserve( result.size() * x.extent );
+                for ( auto const  o : result )
+                    for ( std::size_t  i = 0u ; i < x.extent ; ++i )
+                        next.push_back( o + i * (x.*stride) );
+                result.swap( next );
+            }
+            return result;
+        }
+    };
+
+    //! Below this many multiply-adds, skip packing and loop directly.
+    constexpr  std::size_t  contraction_direct_limit = 1u << 12;
+    //! The rows of `A` packed at once.
+    constexpr  std::size_t  contraction_block_rows = 64u;
+    //! The common dimension packed at once.
+    constexpr  std::size_t  contraction_block_depth = 256u;
+    //! The bytes of `B` to pack at once, picking the columns per block.
+    constexpr  std::size_t  contraction_panel_bytes = 1u << 18;
+
+    /** \brief  Compute `C[q][m][n] = sum over k of A[q][m][k] * B[q][k][n]`.
+
+    Each group's offsets are tabulated for each array once, so any strides and
+    priorities work.  Small products loop straight over the arrays.  Larger
+    ones are cut into blocks of `C`, each a separate task; a task copies the
+    blocks of `A` and `B` it needs into contiguous buffers and accumulates in a
+    local block of `C`, whose innermost loop runs over contiguous columns.
+
+        \param a        The first element of `A`.
+        \param b        The first element of `B`.
+        \param c        The first element of `C`.
+        \param q        The batch axes, found in all three arrays.
+        \param m        The axes found in `A` and `C` only.
+        \param n        The axes found in `B` and `C` only.
+        \param k        The summed axes, not found in `C`.
+        \param threads  The thread count to pass to #parallel_chunks.
+     */
+    template < typename T, typename AIterator, typename BIterator, typename
+     CIterator >
+    void  batched_product( AIterator a, BIterator b, CIterator c,
+     contraction_group const &q, contraction_group const &m,
+     contraction_group const &n, contraction_group const &k, unsigned threads )
+    {
+        typedef contraction_axis  axis;
+
+        auto const  qa = q.offsets( &axis::a ), qb = q.offsets( &axis::b ),
+                    qc = q.offsets( &axis::c ), ma = m.offsets( &axis::a ),
+                    mc = m.offsets( &axis::c ), nb = n.offsets( &axis::b ),
+                    nc = n.offsets( &axis::c ), ka = k.offsets( &axis::a ),
+                    kb = k.offsets( &axis::b );
+        auto const  rows = ma.size(), columns = nb.size(), depth = ka.size();
+
+        if ( qa.size() * rows * columns * depth < contraction_direct_limit )
+        {
+            for ( std::size_t  h = 0u ; h < qa.size() ; ++h )
+                for ( std::size_t  i = 0u ; i < rows ; ++i )
+                    for ( std::size_t  j = 0u ; j < columns ; ++j )
+                    {
+                        T  sum = T();
+
+                        for ( std::size_t  p = 0u ; p < depth ; ++p )
+                            sum = sum + a[ qa[h] + ma[i] + ka[p] ] * b[ qb[h] +
+                             kb[p] + nb[j] ];
+                        c[ qc[h] + mc[i] + nc[j] ] = sum;
+                    }
+            return;
+        }
+
+        auto const  kc = std::min( depth, contraction_block_depth );
+        auto const  mb = std::min( rows, contraction_block_rows );
+        auto const  nbk = std::min( columns, std::max<std::size_t>(
+         contraction_panel_bytes / (kc * sizeof(T)), 16u) );
+        auto const  row_blocks = ( rows + mb - 1u ) / mb;
+        auto const  column_blocks = ( columns + nbk - 1u ) / nbk;
+
+        parallel_chunks( qa.size() * row_blocks * column_blocks, threads, [&](
+         std::size_t tb, std::size_t te ){
+            std::vector<T>  ap( mb * kc ), bp( kc * nbk ), cp( mb * nbk );
+
+            for ( ; tb < te ; ++tb )
+            {
+                auto const  h = tb / ( row_blocks * column_blocks );
+                auto const  i0 = tb / column_blocks % row_blocks * mb;
+                auto const  j0 = tb % column_blocks * nbk;
+                auto const  ms = std::min( mb, rows - i0 );
+                auto const  ns = std::min( nbk, columns - j0 );
+
+                std::fill( cp.begin(), cp.end(), T() );
+                for ( std::size_t  p0 = 0u ; p0 < depth ; p0 += kc )
+                {
+                    auto const  ks = std::min( kc, depth - p0 );
+
+                    for ( std::size_t  i = 0u ; i < ms ; ++i )
+                        for ( std::size_t  p = 0u ; p < ks ; ++p )
+                            ap[ i * ks + p ] = a[ qa[h] + ma[i0 + i] + ka[p0 +
+                             p] ];
+                    for ( std::size_t  p = 0u ; p < ks ; ++p )
+                        for ( std::size_t  j = 0u ; j < ns ; ++j )
+                            bp[ p * ns + j ] = b[ qb[h] + kb[p0 + p] + nb[j0 +
+                             j] ];
+                    for ( std::size_t  i = 0u ; i < ms ; ++i )
+                    {
+                        T * const  row = cp.data() + i * ns;
+
+                        for ( std::size_t  p = 0u ; p < ks ; ++p )
+                        {
+                            T const          x = ap[ i * ks + p ];
+                            T const * const  from = bp.data() + p * ns;
+
+                            for ( std::size_t  j = 0u ; j < ns ; ++j )
+                                row[ j ] = row[ j ] + x * from[ j ];
+                        }
+                    }
+                }
+                for ( std::size_t  i = 0u ; i < ms ; ++i )
+                    for ( std::size_t  j = 0u ; j < ns ; ++j )
+                        c[ qc[h] + mc[i0 + i] + nc[j0 + j] ] = cp[ i * ns + j ];
+            }
+        } );
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Contraction function template definition  --------------------------------//
+
+/** \brief  Multiply two arrays and sum over axes, Einstein-summation style.
+
+Each axis of `a`, `b`, and the result is named by one character of the label
+strings.  The result element for given labels' indexes is the sum, over every
+index of the labels not in `result_labels`, of the products of the `a` and `b`
+elements at those indexes.  For example, labels `"ij"`, `"jk"`, `"ik"` give a
+matrix product; `"bij"`, `"bjk"`, `"bik"` a batched one; `"ijk"`, `"lk"`,
+`"ijl"` a tensor-times-matrix along the last axis; `"i"`, `"j"`, `"ij"` an
+outer product; and `"ii"`, `"i"`, `""` sums the diagonal times a vector.  A
+label repeated within an operand walks its diagonal.
+
+The labels are sorted into batch axes (in all three), row axes (in `a` and the
+result), column axes (in `b` and the result), and summed axes (the rest),
+making a batch of matrix products.  Within each group the axes are ordered by
+their strides, from the operands' #multiarray::priorities, so memory is read in
+order.  Products are computed in blocks sized from the extents and element
+size, each on packed copies of the operands, with the blocks divided among
+threads.  (An `array_md` can take part through #make_multiarray_ref.)
+
+    \pre  `ContainerA` and `ContainerB` have random-access iterators.
+    \pre  `T` is Default-Constructible with a zero value, and supports `+` and
+          `*`.
+
+    \param a              The first operand.
+    \param a_labels       The labels for the axes of `a`, in order.
+    \param b              The second operand.
+    \param b_labels       The labels for the axes of `b`, in order.
+    \param result_labels  The labels for the axes of the result, in order.  A
+                          string literal, whose length sets the result's
+                          rank.
+    \param threads        The maximum number of threads to use.  If zero (the
+                          default), uses the number of hardware threads for
+                          large products and one thread for small ones.
+
+    \throws std::invalid_argument  if `a_labels` or `b_labels` don't have one
+                                   character per axis, a label gets different
+                                   extents, a result label is repeated, or a
+                                   result label isn't in `a_labels` or
+                                   `b_labels`.
+    \throws std::length_error      if `a.size() < a.required_size()`, or
+                                   likewise for `b`.
+    \throws Whatever  element operations, memory allocation, or thread creation
+                      throw.
+
+    \returns  The contraction, in row-major order, with the default index
+              type.
+ */
+template < typename T, std::size_t RankA, class ContainerA, typename
+ IndexTypeA, std::size_t RankB, class ContainerB, typename IndexTypeB,
+ std::size_t RankC1 >
+multiarray<T, RankC1 - 1u>  contract( multiarray<T, RankA, ContainerA,
+ IndexTypeA> const &a, std::string const &a_labels, multiarray<T, RankB,
+ ContainerB, IndexTypeB> const &b, std::string const &b_labels, char const
+ (&result_labels)[ RankC1 ], unsigned threads = 0u )
+{
+    typedef detail::contraction_axis  axis;
+    typedef std::array<std::size_t, RankC1 - 1u>  c_stats_type;
+
+    std::string const  c_labels( result_labels );
+
+    if ( a_labels.size() != RankA || b_labels.size() != RankB ||
+     c_labels.size() != RankC1 - 1u )
+        throw std::invalid_argument{ "Need one label per axis" };
+    detail::require_full_size( a );
+    detail::require_full_size( b );
+
+    // Gather each label's extent and strides; repeats add their strides.
+    std::string        labels;
+    std::vector<axis>  axes;
+    auto const         find = [&]( char l, std::size_t extent ) -> axis & {
+        auto const  i = labels.find( l );
+
+        if ( i == std::string::npos )
+        {
+            labels.push_back( l );
+            axes.push_back( axis{extent, 0u, 0u, 0u} );
+            return axes.back();
+        }
+        if ( axes[i].extent != extent )
+            throw std::invalid_argument{ "Label extents don't match" };
+        return axes[ i ];
+    };
+    auto const         ae = a.extents(), as = a.strides();
+    auto const         be = b.extents(), bs = b.strides();
+
+    for ( std::size_t  d = 0u ; d < RankA ; ++d )
+        find( a_labels[d], ae[d] ).a += as[ d ];
+    for ( std::size_t  d = 0u ; d < RankB ; ++d )
+        find( b_labels[d], be[d] ).b += bs[ d ];
+
+    c_stats_type  ce;
+
+    for ( std::size_t  d = 0u ; d < ce.size() ; ++d )
+    {
+        auto const  i = labels.find( c_labels[d] );
+
+        if ( i == std::string::npos || c_labels.find(c_labels[ d ]) != d )
+            throw std::invalid_argument{ "Bad result label" };
+        ce[ d ] = axes[ i ].extent;
+    }
+
+    std::size_t  count = 1u;
+
+    for ( auto const  x : ce )
+        count *= x;
+
+    multiarray<T, RankC1 - 1u>  result( (std::vector<T>( count )) );
+
+    result.extents( ce );
+
+    auto const  cs = result.strides();
+
+    for ( std::size_t  d = 0u ; d < ce.size() ; ++d )
+        axes[ labels.find(c_labels[ d ]) ].c = cs[ d ];
+
+    // Sort the axes into the groups of a batched matrix product
+    detail::contraction_group  q, m, n, k;
+    std::size_t                work = 1u;
+
+    for ( auto const &x : axes )
+    {
+        work *= x.extent;
+        if ( !x.c )
+            k.axes.push_back( x );
+        else if ( x.a && x.b )
+            q.axes.push_back( x );
+        else
+            ( x.a ? m : n ).axes.push_back( x );
+    }
+    for ( auto  g : {&q, &m, &n, &k} )
+        g->arrange();
+    detail::batched_product<T>( a.begin(), b.begin(), result.begin(), q, m, n,
+     k, detail::thread_count_for(work, threads) );
+    return result;
+}
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_CONTRACTION_HPP
@@ -0,0 +1,423 @@
+//  Boost Multi-dimensional Array Layout-Mapping header file  ----------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  Class templates describing the memory layout of multi-dimensional
+      arrays in the form `std::mdspan` uses, with conversions to and from the
+      array types of this library.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of an extents class template
+    and a strided layout-mapping class template.  They follow the interface
+    requirements of `std::extents` and of a `std::mdspan` layout mapping, so
+    array data can cross library boundaries as a pointer plus a mapping.  Creation
+    functions make mappings from `multiarray` (and `multiarray_ref`),
+    `hybrid_multiarray`, and `array_md` objects, honoring their index
+    priorities.  Another creation function makes a `multiarray_ref` from a
+    pointer and any mapping that describes a dense layout, including the
+    Standard ones.
+
+    \warning  This library requires C++2011 features.  The conversions to the
+      Standard types are only available when `<mdspan>` is.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_MAPPING_HPP
+#define BOOST_CONTAINER_MULTIARRAY_MAPPING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/hybrid_multiarray.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_ref.hpp"
+
+#if __cplusplus > 202002L && defined( __has_include )
+#if __has_include( <mdspan> )
+#include <mdspan>
+#define BOOST_CONTAINER_HAS_STD_MDSPAN
+#endif
+#endif
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Extents class template definition  ---------------------------------------//
+
+/** \brief  A list of run-time extents, following the `std::extents` interface.
+
+    \tparam IndexType  The type of the extents and indexes.
+    \tparam Rank       The number of extents.
+ */
+template < typename IndexType, std::size_t Rank >
+class mdspan_extents
+{
+    static_assert( std::is_integral<IndexType>::value, "Improper index type" );
+
+public:
+    // Types
+    //! The type of each extent.
+    typedef IndexType                                         index_type;
+    //! The unsigned counterpart of #index_type.
+    typedef typename std::make_unsigned<index_type>::type      size_type;
+    //! The type of dimension numbers.
+    typedef std::size_t                                        rank_type;
+
+    // Lifetime management
+    //! Default constructor; all extents are zero.
+    mdspan_extents() noexcept  : sizes()  {}
+    //! Initialize with the given extents.
+    explicit  mdspan_extents( std::array<index_type, Rank> const &e ) noexcept
+      : sizes( e )
+    {}
+    //! \overload
+    template < typename ...Indices >
+    explicit  mdspan_extents( index_type e0, Indices ...e ) noexcept
+      : sizes{ {e0, static_cast<index_type>(e)...} }
+    {
+        static_assert( 1u + sizeof...(Indices) == Rank, "Wrong extent count" );
+    }
+
+    // Observers
+    //! \returns  The number of extents.
+    static constexpr  rank_type  rank() noexcept  { return Rank; }
+    //! \returns  The number of run-time extents, which is all of them.
+    static constexpr  rank_type  rank_dynamic() noexcept  { return Rank; }
+    //! \returns  #dynamic_extent, since no extent is fixed.
+    static constexpr  std::size_t  static_extent( rank_type ) noexcept
+    { return dynamic_extent; }
+    //! \returns  The extent of dimension `r`.
+    index_type  extent( rank_type r ) const noexcept  { return sizes[ r ]; }
+
+    //! \returns  Whether both objects have the same extents.
+    friend
+    bool  operator ==( mdspan_extents const &l, mdspan_extents const &r )
+     noexcept
+    { return l.sizes == r.sizes; }
+    //! \returns  Whether the objects have differing extents.
+    friend
+    bool  operator !=( mdspan_extents const &l, mdspan_extents const &r )
+     noexcept
+    { return !(l == r); }
+
+private:
+    std::array<index_type, Rank>  sizes;
+};
+
+
+//  Layout-mapping class template definitions  -------------------------------//
+
+template < class Extents >
+class mdspan_layout_mapping;
+
+/** \brief  A layout policy whose mappings take arbitrary strides, in the form
+            `std::mdspan` uses.
+ */
+struct mdspan_layout_stride
+{
+    //! The mapping type for the given extents type.
+    template < class Extents >
+    using mapping = mdspan_layout_mapping<Extents>;
+};
+
+/** \brief  Maps index tuples to offsets with a stride per dimension, following
+            the requirements for a `std::mdspan` layout mapping.
+
+The strides of mappings made from this library's array types come from the
+arrays' index priorities, so every offset in `[0, required_span_size())` is
+used exactly once.
+
+    \tparam Extents  The extents type, usually a #mdspan_extents instantiation.
+ */
+template < class Extents >
+class mdspan_layout_mapping
+{
+public:
+    // Types
+    //! The extents type.  Gives access to its template parameter.
+    typedef Extents                             extents_type;
+    //! The type of the extents and indexes.
+    typedef typename extents_type::index_type     index_type;
+    //! The unsigned counterpart of #index_type.
+    typedef typename extents_type::size_type       size_type;
+    //! The type of dimension numbers.
+    typedef typename extents_type::rank_type       rank_type;
+    //! The layout policy type.
+    typedef mdspan_layout_stride                 layout_type;
+    //! The type for giving and receiving stride lists.
+    typedef std::array<index_type, Extents::rank()>  strides_type;
+
+    // Lifetime management
+    //! Default constructor; all extents and strides are zero.
+    mdspan_layout_mapping() noexcept  : sizes(), steps()  {}
+    //! Initialize with the given extents and strides.
+    mdspan_layout_mapping( extents_type const &e, strides_type const &s )
+     noexcept
+      : sizes( e ), steps( s )
+    {}
+
+    // Observers
+    //! \returns  The extents.
+    extents_type const &  extents() const noexcept  { return sizes; }
+    //! \returns  The stride for each dimension.
+    strides_type          strides() const noexcept  { return steps; }
+    //! \returns  The stride for dimension `r`.
+    index_type      stride( rank_type r ) const noexcept { return steps[ r ]; }
+
+    //! \returns  One past the largest offset an index tuple can map to, or
+    //!           zero if there are no valid index tuples.
+    index_type  required_span_size() const noexcept
+    {
+        index_type  result = 1;
+
+        for ( rank_type  r = 0u ; r < extents_type::rank() ; ++r )
+        {
+            if ( !sizes.extent(r) )
+                return 0;
+            result += ( sizes.extent(r) - 1 ) * steps[ r ];
+        }
+        return result;
+    }
+
+    /** \brief  Map an index tuple to an offset.
+        \pre    There are exactly `extents_type::rank()` indexes, each less than
+                its extent.
+        \param i  The indexes.
+        \returns  The sum of each index times its stride.
+     */
+    template < typename ...Indices >
+    index_type  operator ()( Indices ...i ) const noexcept
+    {
+        static_assert( sizeof...(Indices) == extents_type::rank(),
+         "Wrong index count" );
+
+        index_type const  list[] = { 0, static_cast<index_type>(i)... };
+
+        return std::inner_product( list + 1, list + 1 + sizeof...(Indices),
+         steps.begin(), index_type(0) );
+    }
+
+    //! \returns  `true`, as the strides are assumed to be non-overlapping.
+    static constexpr  bool     is_always_unique() noexcept  { return true; }
+    //! \returns  `false`, as arbitrary strides may leave gaps.
+    static constexpr  bool  is_always_exhaustive() noexcept  { return false; }
+    //! \returns  `true`, since this is a strided layout.
+    static constexpr  bool    is_always_strided() noexcept  { return true; }
+
+    //! \returns  `true`, as the strides are assumed to be non-overlapping.
+    static constexpr  bool     is_unique() noexcept  { return true; }
+    //! \returns  Whether every offset up to #required_span_size() is used.
+    bool                   is_exhaustive() const noexcept
+    {
+        index_type  product = 1;
+
+        for ( rank_type  r = 0u ; r < extents_type::rank() ; ++r )
+            product *= sizes.extent( r );
+        return required_span_size() == product;
+    }
+    //! \returns  `true`, since this is a strided layout.
+    static constexpr  bool    is_strided() noexcept  { return true; }
+
+    //! \returns  Whether both objects have the same extents and strides.
+    friend
+    bool  operator ==( mdspan_layout_mapping const &l, mdspan_layout_mapping
+     const &r ) noexcept
+    { return l.sizes == r.sizes && l.steps == r.steps; }
+    //! \returns  Whether the objects differ in extents or strides.
+    friend
+    bool  operator !=( mdspan_layout_mapping const &l, mdspan_layout_mapping
+     const &r ) noexcept
+    { return !(l == r); }
+
+private:
+    extents_type  sizes;
+    strides_type  steps;
+};
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Compute row-major strides from extents.
+    template < typename T, std::size_t R >
+    std::array<T, R>  row_major_strides( std::array<T, R> const &e )
+    {
+        std::array<T, R>  result;
+        T                 product = 1;
+
+        for ( auto  i = R ; i-- ; )
+        {
+            result[ i ] = product;
+            product *= e[ i ];
+        }
+        return result;
+    }
+
+    //! Make a mapping from matching extent and stride lists.
+    template < typename T, std::size_t R >
+    mdspan_layout_mapping<mdspan_extents<T, R>>
+    make_mapping( std::array<T, R> const &e, std::array<T, R> const &s )
+    {
+        return mdspan_layout_mapping<mdspan_extents<T, R>>(
+         mdspan_extents<T, R>(e), s );
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Layout-mapping creation functions  ---------------------------------------//
+
+/** \brief  Describe the layout of a `multiarray` (or `multiarray_ref`).
+
+    \param a  The array to describe.
+
+    \returns  A mapping with `a.extents()` and `a.strides()`.  Together with the
+              address of the first element, it locates the same elements that
+              `a` does.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+mdspan_layout_mapping<mdspan_extents<IndexType, Rank>>
+make_layout_mapping( multiarray<T, Rank, Container, IndexType> const &a )
+{ return detail::make_mapping( a.extents(), a.strides() ); }
+
+/** \overload
+    \details  The layout of a `hybrid_multiarray` is always row-major.
+ */
+template < typename T, class Shape, class Container >
+inline
+mdspan_layout_mapping<mdspan_extents<typename Container::size_type,
+ Shape::rank>>
+make_layout_mapping( hybrid_multiarray<T, Shape, Container> const &a )
+{
+    auto const  e = a.extents();
+
+    return detail::make_mapping( e, detail::row_major_strides(e) );
+}
+
+/** \overload
+    \details  The layout of an `array_md` is always row-major.
+ */
+template < typename T, std::size_t ...N >
+inline
+mdspan_layout_mapping<mdspan_extents<std::size_t, sizeof...(N)>>
+make_layout_mapping( array_md<T, N...> const & )
+{
+    std::array<std::size_t, sizeof...(N)> const  e{ {N...} };
+
+    return detail::make_mapping( e, detail::row_major_strides(e) );
+}
+
+
+//  Multi-dimensional array reference from layout-mapping  -------------------//
+
+/** \brief  View memory described by a layout mapping as a `multiarray_ref`.
+
+The mapping can be from this library or any other type that follows the
+`std::mdspan` layout-mapping interface, like `std::layout_right::mapping`.  Its
+strides have to describe a dense layout, where the dimensions, sorted by
+stride, each step over the whole block of the next-smaller one.  Such a layout
+can be expressed as a list of priorities.  (Strides for dimensions with an
+extent of 1 are ignored, since they never contribute to an offset.)
+
+    \pre  `[p, p + m.required_span_size())` is a valid range.
+
+    \param p  The address of the element with all-zero indexes.
+    \param m  The mapping.
+
+    \throws std::out_of_range      if an extent is zero.
+    \throws std::invalid_argument  if the strides don't describe a dense layout.
+
+    \returns  A view of `p` with the extents of `m` and the priorities implied
+              by its strides.
+ */
+template < typename T, class Mapping >
+multiarray_ref<T, Mapping::extents_type::rank()>
+make_multiarray_ref( T *p, Mapping const &m )
+{
+    typedef multiarray_ref<T, Mapping::extents_type::rank()>  result_type;
+    typedef typename result_type::stats_type                   stats_type;
+    typedef typename result_type::size_type                     size_type;
+
+    auto const  rank = Mapping::extents_type::rank();
+    stats_type  e, s, p_list;
+
+    for ( size_type  r = 0u ; r < rank ; ++r )
+    {
+        e[ r ] = static_cast<size_type>( m.extents().extent(r) );
+        s[ r ] = e[ r ] > 1u ? static_cast<size_type>( m.stride(r) ) : 0u;
+    }
+
+    // Most-major dimensions have the largest strides.
+    std::iota( p_list.begin(), p_list.end(), size_type(0) );
+    std::stable_sort( p_list.begin(), p_list.end(), [&s]( size_type l,
+     size_type r ){ return s[l] > s[r]; } );
+
+    // Check density, from the least-major dimension up.
+    size_type  expected = 1u;
+
+    for ( auto  i = rank ; i-- ; )
+    {
+        auto const  d = p_list[ i ];
+
+        if ( e[d] > 1u )
+        {
+            if ( s[d] != expected )
+                throw std::invalid_argument{ "Layout isn't dense" };
+            expected *= e[ d ];
+        }
+    }
+    return result_type( p, e, p_list );
+}
+
+
+//  Conversions to Standard types  -------------------------------------------//
+
+#ifdef BOOST_CONTAINER_HAS_STD_MDSPAN
+/** \brief  Convert a mapping to the Standard strided mapping type.
+
+    \param m  The mapping to convert.
+
+    \returns  A `std::layout_stride::mapping` with the same extents and strides.
+ */
+template < typename IndexType, std::size_t Rank >
+std::layout_stride::mapping<std::dextents<IndexType, Rank>>
+to_std_mapping( mdspan_layout_mapping<mdspan_extents<IndexType, Rank>> const &m
+ )
+{
+    std::array<IndexType, Rank>  e;
+
+    for ( std::size_t  r = 0u ; r < Rank ; ++r )
+        e[ r ] = m.extents().extent( r );
+    return std::layout_stride::mapping<std::dextents<IndexType, Rank>>(
+     std::dextents<IndexType, Rank>(e), m.strides() );
+}
+#endif
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_MAPPING_HPP
@@ -0,0 +1,240 @@
+//  Boost Multi-dimensional Array Reference header file  ---------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template that grants multiple-value indexing over element
+      storage owned by someone else.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template that works
+    like `multiarray`, but views a caller-supplied block of memory instead of
+    owning a container.  There are also creation functions that view the
+    elements of an `array_md` object.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_REF_HPP
+#define BOOST_CONTAINER_MULTIARRAY_REF_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+
+/** \brief  A non-owning, fixed-length view of a contiguous element block, with
+            enough of the container interface to be used by `multiarray`.
+
+    \tparam T  The type of the elements.  May be `const`-qualified for
+               read-only access.
+ */
+template < typename T >
+class foreign_span
+{
+public:
+    // Container types
+    typedef typename std::remove_cv<T>::type  value_type;
+    typedef T &                                reference;
+    typedef T const &                    const_reference;
+    typedef T *                                  pointer;
+    typedef T const *                      const_pointer;
+    typedef pointer                             iterator;
+    typedef const_pointer                 const_iterator;
+    typedef std::size_t                        size_type;
+    typedef std::ptrdiff_t               difference_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    foreign_span() noexcept  : first( nullptr ), count( 0u )  {}
+    foreign_span( pointer p, size_type n ) noexcept  : first( p ), count( n )
+    {}
+
+    // Container interface
+          iterator  begin()       noexcept  { return first; }
+    const_iterator  begin() const noexcept  { return first; }
+          iterator    end()       noexcept  { return first + count; }
+    const_iterator    end() const noexcept  { return first + count; }
+
+          pointer    data()       noexcept  { return first; }
+    const_pointer    data() const noexcept  { return first; }
+
+    size_type        size() const noexcept  { return count; }
+    bool            empty() const noexcept  { return !count; }
+
+    void  swap( foreign_span &other ) noexcept
+    { std::swap(first, other.first); std::swap(count, other.count); }
+
+private:
+    pointer    first;
+    size_type  count;
+};
+
+//! Swap routine for `foreign_span`.
+template < typename T >
+inline
+void  swap( foreign_span<T> &a, foreign_span<T> &b ) noexcept  { a.swap(b); }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Multi-dimensional array reference class template definition  -------------//
+
+/** \brief  A view of a multi-dimensional array over external memory.
+
+This class template provides the #multiarray interface (element access, extent
+and priority management, #multiarray::apply, #multiarray::fill, and chained
+`operator []`) over a block of elements that it does **not** own.  The block
+can come from a network buffer, a memory-mapped region, an #array_md object
+(see #make_multiarray_ref), or anything else that provides contiguous elements.
+No elements are copied.
+
+Copying a `multiarray_ref` copies the view, not the elements.  The viewed
+memory must outlive all views of it.  Element access follows the constness of
+the view object, like a container.
+
+    \pre  `Rank >= 0`.
+
+    \tparam T     The type of the elements.  Use a `const`-qualified type to
+                  view read-only memory.
+    \tparam Rank  The number of index coordinates to access an element.
+
+ */
+template < typename T, std::size_t Rank >
+class multiarray_ref
+    : public multiarray<typename std::remove_cv<T>::type, Rank,
+      detail::foreign_span<T>>
+{
+    // Base type
+    using base_type = multiarray<typename std::remove_cv<T>::type, Rank,
+     detail::foreign_span<T>>;
+
+public:
+    // Other types
+    using typename base_type::container_type;
+    using typename base_type::size_type;
+    using typename base_type::stats_type;
+    //! The type for pointing to an element.
+    typedef T *                                          pointer;
+    //! The type for pointing to an element, read-only.
+    typedef typename std::remove_cv<T>::type const *  const_pointer;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  View memory in row-major order.
+        \pre  `[p, p + product of e)` is a valid range.
+        \param p  The address of the first element.
+        \param e  The extents of the view.
+        \throws std::out_of_range    when any element of `e` is zero.
+        \throws std::overflow_error  when the product of `e`'s elements exceeds
+                                     the limit of `size_type`.
+        \post  `extents() == e`.
+        \post  `priorities() == {{ 0, ..., (dimensionality - 1) }}`.
+        \post  `size() == required_size()`.
+     */
+    multiarray_ref( pointer p, stats_type const &e )
+    { this->extents( e ); c = container_type( p, this->required_size() ); }
+    /** \brief  View memory in the given index priority order.
+        \pre  `[p, p + product of e)` is a valid range.
+        \param p   The address of the first element.
+        \param e   The extents of the view.
+        \param pr  The index priorities of the view.  See
+                   #multiarray::priorities.
+        \throws Whatever  #multiarray::extents_and_priorities throws.
+        \post  `extents() == e && priorities() == pr`.
+        \post  `size() == required_size()`.
+     */
+    multiarray_ref( pointer p, stats_type const &e, stats_type const &pr )
+    {
+        this->extents_and_priorities( e, pr );
+        c = container_type( p, this->required_size() );
+    }
+
+    //! \returns  The address of the first element viewed.
+    pointer        data()       noexcept  { return c.data(); }
+    //! \overload
+    const_pointer  data() const noexcept  { return c.data(); }
+
+protected:
+    using base_type::c;
+};
+
+
+//  Multi-dimensional array reference creation functions  --------------------//
+
+/** \brief  View an `array_md` object as a `multiarray_ref`.
+
+The view has the same extents as the array's template arguments, in row-major
+order, and references the array's elements directly.
+
+    \pre  The first extent of `a`, if any, is not zero.
+
+    \param a  The array to view.
+
+    \throws std::out_of_range  if `a` has a zero extent.
+
+    \returns  A view of `a` with `extents() == {{ N... }}`.
+ */
+template < typename T, std::size_t ...N >
+inline
+multiarray_ref<T, sizeof...(N)>  make_multiarray_ref( array_md<T, N...> &a )
+{
+    return multiarray_ref<T, sizeof...(N)>( a.data(), typename
+     multiarray_ref<T, sizeof...(N)>::stats_type{ {N...} } );
+}
+
+//! \overload
+template < typename T, std::size_t ...N >
+inline
+multiarray_ref<T const, sizeof...(N)>
+make_multiarray_ref( array_md<T, N...> const &a )
+{
+    return multiarray_ref<T const, sizeof...(N)>( a.data(), typename
+     multiarray_ref<T const, sizeof...(N)>::stats_type{ {N...} } );
+}
+
+/** \brief  Swap routine for `multiarray_ref`.
+
+Exchanges which memory (and shape) each view refers to.  No elements move.
+
+    \param a  The first object to have its state exchanged.
+    \param b  The second object to have its state exchanged.
+ */
+template < typename T, std::size_t Rank >
+inline
+void  swap( multiarray_ref<T, Rank> &a, multiarray_ref<T, Rank> &b ) noexcept
+{ a.swap(b); }
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_REF_HPP
@@ -0,0 +1,379 @@
+//  Boost Multi-dimensional Array Search header file  ------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  Function templates that search the elements of a `multiarray` or
+      `array_md`, giving the index coordinates of what they find.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of function templates that test
+    or compare every element of a multi-dimensional array, like `find_if` and
+    `argmin`.  Unlike going through `apply`, they walk the elements in memory
+    order without forming any index coordinates, and only work out the
+    coordinates of the result.  The walk goes a block of elements at a time,
+    with a branch-free inner loop the compiler can vectorize, and searches stop
+    at the first block with a match.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_SEARCH_HPP
+#define BOOST_CONTAINER_MULTIARRAY_SEARCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+#include "boost/container/multiarray_ref.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! The number of elements tested between chances to stop early.
+    constexpr  std::size_t  search_block = 64u;
+
+    //! Convert a memory offset into index coordinates.
+    template < class MultiArray >
+    typename MultiArray::stats_type  index_at( MultiArray const &a, typename
+     MultiArray::size_type offset )
+    {
+        auto const                       e = a.extents(), s = a.strides();
+        typename MultiArray::stats_type  result;
+
+        for ( std::size_t  d = 0u ; d < e.size() ; ++d )
+            result[ d ] = offset / s[ d ] % e[ d ];
+        return result;
+    }
+
+    //! \returns  The offset of the first element matching `pred`, or `n`.
+    template < typename Iterator, typename Predicate >
+    std::size_t  flat_find_if( Iterator first, std::size_t n, Predicate &pred )
+    {
+        for ( std::size_t  b = 0u ; b < n ; b += search_block )
+        {
+            auto const  e = std::min( n, b + search_block );
+            bool        hit = false;
+
+            for ( auto  i = b ; i < e ; ++i )
+                hit |= static_cast<bool>( pred(first[ i ]) );
+            if ( hit )
+                for ( auto  i = b ; ; ++i )
+                    if ( pred(first[ i ]) )
+                        return i;
+        }
+        return n;
+    }
+
+    //! \returns  The offset of the first element that no other is before.
+    //! \pre  `n > 0`.
+    template < typename Iterator, class Compare >
+    std::size_t  flat_min_element( Iterator first, std::size_t n, Compare
+     &comp )
+    {
+        typedef typename std::iterator_traits<Iterator>::value_type  value_type;
+
+        // Find the least value and the block it's in, then re-find it there.
+        value_type   best = first[ 0 ];
+        std::size_t  best_block = 0u;
+
+        for ( std::size_t  b = 0u ; b < n ; b += search_block )
+        {
+            auto const  e = std::min( n, b + search_block );
+            value_type  least = first[ b ];
+
+            for ( auto  i = b + 1u ; i < e ; ++i )
+                least = comp( first[i], least ) ? first[ i ] : least;
+            if ( comp(least, best) )
+            {
+                best = least;
+                best_block = b;
+            }
+        }
+        for ( auto  i = best_block ; ; ++i )
+            if ( !comp(best, first[ i ]) )
+                return i;
+    }
+
+    //! Swaps the arguments of a comparison, to turn minimums into maximums.
+    template < class Compare >
+    struct reversed_compare
+    {
+        Compare  comp;
+
+        template < typename T, typename U >
+        bool  operator ()( T const &x, U const &y )  { return comp(y, x); }
+    };
+
+}  // namespace detail
+//! \endcond
+
+
+//  Search result class template definition  ---------------------------------//
+
+/** \brief  The outcome of a search that may not find anything.
+
+    \tparam SizeType  The index coordinate type.
+    \tparam Rank      The number of index coordinates.
+ */
+template < typename SizeType, std::size_t Rank >
+struct search_result
+{
+    //! Whether an element was found.
+    bool                          found;
+    //! The index coordinates of the element, if #found.
+    std::array<SizeType, Rank>    index;
+
+    //! \returns  #found
+    explicit  operator bool() const  { return found; }
+};
+
+
+//  Search function template definitions  ------------------------------------//
+
+/** \brief  Find the first element matching a predicate.
+
+Elements are tested in memory order, given by #multiarray::priorities.  (For
+the default priorities, that is row-major order.)  The search stops at the
+first block of elements holding a match.
+
+    \pre  `Container` has random-access iterators.
+    \pre  `pred` has no side effects; it may be called more than once for an
+          element.
+
+    \param a     The array to search.
+    \param pred  The predicate, taking an element.
+
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `pred` throws.
+
+    \returns  A #search_result with the index coordinates of the first element
+              for which `pred` returns `true`, if any.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Predicate >
+search_result<IndexType, Rank>  find_if( multiarray<T, Rank, Container,
+ IndexType> const &a, Predicate pred )
+{
+    detail::require_full_size( a );
+
+    auto const  n = a.required_size();
+    auto const  i = detail::flat_find_if( a.begin(), n, pred );
+
+    return { i < n, i < n ? detail::index_at(a, i) : a.extents() };
+}
+
+/** \brief  Check whether any element matches a predicate.
+    \details  Stops early like #find_if.
+    \pre  `Container` has random-access iterators.
+    \pre  `pred` has no side effects.
+    \param a     The array to search.
+    \param pred  The predicate, taking an element.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `pred` throws.
+    \returns  `true` if `pred` returns `true` for some element.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Predicate >
+bool  any_of( multiarray<T, Rank, Container, IndexType> const &a, Predicate
+ pred )
+{
+    detail::require_full_size( a );
+    return detail::flat_find_if( a.begin(), a.required_size(), pred ) <
+     a.required_size();
+}
+
+/** \brief  Check whether every element matches a predicate.
+    \details  Stops early, at the first block with a mismatch.
+    \pre  `Container` has random-access iterators.
+    \pre  `pred` has no side effects.
+    \param a     The array to search.
+    \param pred  The predicate, taking an element.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `pred` throws.
+    \returns  `true` if `pred` returns `true` for every element.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Predicate >
+inline
+bool  all_of( multiarray<T, Rank, Container, IndexType> const &a, Predicate
+ pred )
+{
+    auto  fails = [&pred]( T const &x ){ return !pred(x); };
+
+    return !any_of( a, fails );
+}
+
+/** \brief  Count the elements matching a predicate.
+    \details  Every element is tested, in a branch-free loop.
+    \pre  `Container` has random-access iterators.
+    \param a     The array to search.
+    \param pred  The predicate, taking an element.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `pred` throws.
+    \returns  The number of elements for which `pred` returns `true`.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Predicate >
+typename Container::size_type  count_if( multiarray<T, Rank, Container,
+ IndexType> const &a, Predicate pred )
+{
+    detail::require_full_size( a );
+
+    auto const                     first = a.begin();
+    auto const                     n = a.required_size();
+    typename Container::size_type  result = 0u;
+
+    for ( std::size_t  i = 0u ; i < n ; ++i )
+        result += static_cast<bool>( pred(first[ i ]) );
+    return result;
+}
+
+/** \brief  Find the least element.
+
+Each block of elements is reduced to its least value first, so only the block
+holding the overall minimum is searched for the position.  Ties go to the
+element first in memory order.
+
+    \pre  `Container` has random-access iterators.
+    \pre  `comp` is a strict weak ordering over `T`, and `T` is
+          Copy-Constructible and Copy-Assignable.
+
+    \param a     The array to search.
+    \param comp  The ordering.  If not given, defaults to `std::less<T>`.
+
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `comp` or copying elements throws.
+
+    \returns  The index coordinates of an element that no other element
+              compares before.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Compare >
+std::array<IndexType, Rank>  argmin( multiarray<T, Rank, Container, IndexType>
+ const &a, Compare comp )
+{
+    detail::require_full_size( a );
+    return detail::index_at( a, detail::flat_min_element(a.begin(),
+     a.required_size(), comp) );
+}
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+std::array<IndexType, Rank>  argmin( multiarray<T, Rank, Container, IndexType>
+ const &a )
+{ return argmin(a, std::less<T>{}); }
+
+/** \brief  Find the greatest element.
+    \details  Works like #argmin with the arguments of `comp` swapped.
+    \pre  `Container` has random-access iterators.
+    \pre  `comp` is a strict weak ordering over `T`, and `T` is
+          Copy-Constructible and Copy-Assignable.
+    \param a     The array to search.
+    \param comp  The ordering.  If not given, defaults to `std::less<T>`.
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  `comp` or copying elements throws.
+    \returns  The index coordinates of an element that compares before no
+              other element, the first one in memory order for ties.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType,
+ class Compare >
+inline
+std::array<IndexType, Rank>  argmax( multiarray<T, Rank, Container, IndexType>
+ const &a, Compare comp )
+{ return argmin(a, detail::reversed_compare<Compare>{ comp }); }
+
+//! \overload
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+inline
+std::array<IndexType, Rank>  argmax( multiarray<T, Rank, Container, IndexType>
+ const &a )
+{ return argmax(a, std::less<T>{}); }
+
+/** \brief  Find the first element of an `array_md` matching a predicate.
+    \details  Views `a` with #make_multiarray_ref, then calls the `multiarray`
+              version.
+    \see  #find_if(multiarray<T,Rank,Container,IndexType> const&,Predicate)
+ */
+template < typename T, std::size_t ...N, class Predicate >
+inline
+search_result<std::size_t, sizeof...(N)>  find_if( array_md<T, N...> const &a,
+ Predicate pred )
+{ return find_if(make_multiarray_ref( a ), pred); }
+
+//! \overload
+template < typename T, std::size_t ...N, class Predicate >
+inline
+bool  any_of( array_md<T, N...> const &a, Predicate pred )
+{ return any_of(make_multiarray_ref( a ), pred); }
+
+//! \overload
+template < typename T, std::size_t ...N, class Predicate >
+inline
+bool  all_of( array_md<T, N...> const &a, Predicate pred )
+{ return all_of(make_multiarray_ref( a ), pred); }
+
+//! \overload
+template < typename T, std::size_t ...N, class Predicate >
+inline
+std::size_t  count_if( array_md<T, N...> const &a, Predicate pred )
+{ return count_if(make_multiarray_ref( a ), pred); }
+
+//! \overload
+template < typename T, std::size_t ...N, class Compare >
+inline
+std::array<std::size_t, sizeof...(N)>  argmin( array_md<T, N...> const &a,
+ Compare comp )
+{ return argmin(make_multiarray_ref( a ), comp); }
+
+//! \overload
+template < typename T, std::size_t ...N >
+inline
+std::array<std::size_t, sizeof...(N)>  argmin( array_md<T, N...> const &a )
+{ return argmin(a, std::less<T>{}); }
+
+//! \overload
+template < typename T, std::size_t ...N, class Compare >
+inline
+std::array<std::size_t, sizeof...(N)>  argmax( array_md<T, N...> const &a,
+ Compare comp )
+{ return argmax(make_multiarray_ref( a ), comp); }
+
+//! \overload
+template < typename T, std::size_t ...N >
+inline
+std::array<std::size_t, sizeof...(N)>  argmax( array_md<T, N...> const &a )
+{ return argmax(a, std::less<T>{}); }
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_SEARCH_HPP
@@ -0,0 +1,235 @@
+//  Boost Multi-dimensional Array Snapshot header file  ----------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template that publishes immutable versions of an array to
+      concurrent readers.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template holding the
+    current version of an object, usually a `multiarray`, behind a shared
+    pointer that readers copy without taking any lock.  A writer builds the
+    next version separately and publishes it in one step, waiting only for
+    copies of the pointer already in progress.  Old versions are freed when
+    their last reader lets go.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_SNAPSHOT_HPP
+#define BOOST_CONTAINER_MULTIARRAY_SNAPSHOT_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Snapshot holder class template definition  -------------------------------//
+
+/** \brief  Holds the current immutable version of an array for many readers.
+
+Readers call #load to get a `shared_ptr` to the current version.  The version
+can't change while held, so a reader sees a consistent array for as long as it
+keeps the pointer, no matter how many times a writer publishes in between.
+
+The holder keeps two pointer slots, an atomic index of the current one, and a
+count of the loads in progress on each slot, in the manner of read-copy-update.
+A #load marks itself in progress on the current slot, checks that the slot is
+still current, copies the pointer, and unmarks itself.  That is a few atomic
+operations and no lock, and a reader never waits on another thread; it only
+retries when a publish finished in between.  (All readers still update the
+same counters and the version's reference count, so those cache lines are
+shared.)  A publish fills the spare slot, makes it current, then waits for the
+loads still copying from the old slot, never for the snapshots readers keep.
+Publishes are serialized by a spin lock among the writers.
+
+A writer calls #publish with a complete new version, or #update to copy the
+current version, change the copy, and publish it.  (With copy-on-write storage,
+like #cow_multiarray, copying the elements is deferred until the first write,
+which then copies all of them.)  The old version is destroyed when the last
+snapshot of it is released, by whichever thread releases it.
+
+Concurrent calls of #load, #publish, and #update are safe.  Concurrent
+#update calls may lose changes, since each one copies the version current at
+its start; use a single writer, or #compare_and_publish.
+
+    \tparam Array  The type of the published object, usually a `multiarray`.
+ */
+template < class Array >
+class multiarray_snapshot
+{
+public:
+    // Template parameters
+    //! The type of the published object.  Gives access to its template
+    //! parameter.
+    typedef Array                        value_type;
+
+    // Other types
+    //! The type of a reader's handle to a version.
+    typedef std::shared_ptr<Array const>  snapshot_type;
+
+    // Lifetime management
+    //! Default constructor; publishes a default-constructed object.
+    multiarray_snapshot()
+      : multiarray_snapshot( std::make_shared<Array const>() )
+    {}
+    //! Publish the given object as the first version.
+    explicit  multiarray_snapshot( Array initial )
+      : multiarray_snapshot( std::make_shared<Array const>(std::move(
+        initial )) )
+    {}
+
+    // (No copying or moving, since the pointer is shared between threads.)
+    multiarray_snapshot( multiarray_snapshot const & ) = delete;
+    multiarray_snapshot &  operator =( multiarray_snapshot const & ) = delete;
+
+    // Reading
+    /** \returns  The current version.  It stays valid, and unchanged, as long
+                  as the returned pointer (or a copy of it) exists.
+     */
+    snapshot_type  load() const noexcept
+    {
+        for ( ;; )
+        {
+            auto const  i = live.load();
+
+            ++loading[ i ];
+            if ( live.load() == i )
+            {
+                snapshot_type  result = slots[ i ];
+
+                --loading[ i ];
+                return result;
+            }
+            --loading[ i ];  // A publish switched slots; try the new one.
+        }
+    }
+
+    // Writing
+    /** \brief  Make a new version current.
+        \param next  The new version.  Must not be null.
+        \post  Later calls of #load return `next`.
+     */
+    void  publish( snapshot_type next ) noexcept
+    {
+        snapshot_type      old;
+        writer_lock const  lock( *this );
+
+        old = install( std::move(next) );
+    }
+    //! \overload
+    void  publish( Array next )
+    { publish(std::make_shared<Array const>( std::move(next) )); }
+
+    /** \brief  Make a new version current, if the current one is as expected.
+        \param expected  The version the new one was made from.  If it is not
+                         current, it is changed to the current version.
+        \param next      The new version.  Must not be null.
+        \returns  Whether `next` was published.
+     */
+    bool  compare_and_publish( snapshot_type &expected, snapshot_type next )
+     noexcept
+    {
+        snapshot_type      old;
+        writer_lock const  lock( *this );
+        auto const &       current = slots[ live.load() ];
+
+        if ( current != expected )
+        {
+            old = std::move( expected );
+            expected = current;
+            return false;
+        }
+        old = install( std::move(next) );
+        return true;
+    }
+
+    /** \brief  Publish a changed copy of the current version.
+        \param f  The function changing the copy.  It takes an `Array &`.
+        \throws Whatever  copying the array or `f` throws.  Nothing is
+                          published then.
+        \returns  The published version.
+     */
+    template < typename Function >
+    snapshot_type  update( Function &&f )
+    {
+        auto  next = std::make_shared<Array>( *load() );
+
+        std::forward<Function>( f )( *next );
+        publish( next );
+        return next;
+    }
+
+private:
+    // Holds the writers' spin lock for its lifetime.
+    class writer_lock
+    {
+    public:
+        explicit  writer_lock( multiarray_snapshot &s ) noexcept  : owner( s )
+        {
+            while ( owner.writing.test_and_set(std::memory_order_acquire) )
+                std::this_thread::yield();
+        }
+        ~writer_lock()  { owner.writing.clear( std::memory_order_release ); }
+
+    private:
+        multiarray_snapshot &  owner;
+    };
+
+    explicit  multiarray_snapshot( snapshot_type initial ) noexcept
+    {
+        slots[ 0 ] = std::move( initial );
+        live.store( 0u );
+        loading[ 0 ].store( 0u );
+        loading[ 1 ].store( 0u );
+        writing.clear();
+    }
+
+    // Install `next` in the spare slot, make it current, and take the old
+    // version out once no load is copying from its slot.  The caller holds
+    // the writers' lock, and releases the old version after unlocking, so its
+    // destructor doesn't hold up other writers.
+    snapshot_type  install( snapshot_type next ) noexcept
+    {
+        auto const  i = live.load();
+
+        slots[ 1u - i ] = std::move( next );
+        live.store( 1u - i );
+        while ( loading[i].load() )
+            std::this_thread::yield();
+        return std::move( slots[i] );
+    }
+
+    // A slot is written only by a writer holding the lock, and only while it
+    // isn't current and no load is copying from it.  All the atomics use
+    // sequentially consistent ordering, which the slot handoff relies on.
+    snapshot_type                     slots[ 2 ];
+    std::atomic<unsigned>             live;
+    mutable std::atomic<std::size_t>  loading[ 2 ];
+    std::atomic_flag                  writing;
+};
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_SNAPSHOT_HPP
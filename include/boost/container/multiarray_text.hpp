@@ -0,0 +1,511 @@
+//  Boost Multi-dimensional Array Text I/O header file  ----------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  Function templates that read and write multi-dimensional arrays of
+      numbers as delimited text, in bulk.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of function templates that
+    convert between text, like CSV or whitespace-separated columns, and
+    `multiarray` or `array_md` objects of arithmetic types.  The text is moved
+    through large buffers instead of element-wise stream extraction and
+    insertion, numbers are converted with `std::from_chars` and `std::to_chars`
+    when the Standard library has them, and lines can be parsed on several
+    threads.  An array's shape can be taken from the text's line and column
+    counts.
+
+    \warning  This library requires C++2011 features.  The `<charconv>`
+      conversions are used when available (C++2017), with C-library fallbacks
+      otherwise.
+ */
+
+#ifndef BOOST_CONTAINER_MULTIARRAY_TEXT_HPP
+#define BOOST_CONTAINER_MULTIARRAY_TEXT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 201703L && defined( __has_include )
+#if __has_include( <charconv> )
+#include <charconv>
+#endif
+#endif
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+#include "boost/container/multiarray_ref.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Whether `T` is read and written as a number.  (The `<charconv>`
+    //! conversions are deleted for `bool`.)
+    template < typename T >
+    struct is_text_number
+        : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+          !std::is_same<typename std::remove_cv<T>::type, bool>::value>
+    {};
+
+    //! Characters that separate values on a line.
+    inline
+    bool  is_text_delimiter( char c ) noexcept
+    { return c == ' ' || c == ',' || c == '\t' || c == ';' || c == '\r'; }
+
+    //! Read all of a stream into a string, in large blocks.
+    inline
+    std::string  slurp_text( std::istream &is )
+    {
+        std::string        result;
+        std::size_t const  block = 1u << 20;
+
+        for ( ;; )
+        {
+            auto const  old = result.size();
+
+            result.resize( old + block );
+            is.read( &result[old], static_cast<std::streamsize>(block) );
+            result.resize( old + static_cast<std::size_t>(is.gcount()) );
+            if ( !is )
+                break;
+        }
+        return result;
+    }
+
+    //! Parse one integer; `p` moves past it.
+    template < typename T >
+    typename std::enable_if<std::is_integral<T>::value, bool>::type
+    parse_text_value( char const *&p, char const *last, T &out )
+    {
+#ifdef __cpp_lib_to_chars
+        auto const  r = std::from_chars( p, last, out );
+
+        if ( r.ec == std::errc::result_out_of_range )
+            throw std::out_of_range{ "Value too large for element type" };
+        if ( r.ec != std::errc{} )
+            return false;
+        p = r.ptr;
+        return true;
+#else
+        // The buffer is null-terminated, and a line ends before "last".
+        char *  stop;
+
+        errno = 0;
+        if ( std::is_signed<T>::value )
+        {
+            auto const  x = std::strtoll( p, &stop, 10 );
+
+            if ( errno == ERANGE || x < std::numeric_limits<T>::min() || x >
+             std::numeric_limits<T>::max() )
+                throw std::out_of_range{ "Value too large for element type" };
+            out = static_cast<T>( x );
+        }
+        else
+        {
+            auto const  x = std::strtoull( p, &stop, 10 );
+
+            if ( *p == '-' )
+                return false;
+            if ( errno == ERANGE || x > std::numeric_limits<T>::max() )
+                throw std::out_of_range{ "Value too large for element type" };
+            out = static_cast<T>( x );
+        }
+        if ( stop == p || stop > last )
+            return false;
+        p = stop;
+        return true;
+#endif
+    }
+
+    //! Parse one floating-point number; `p` moves past it.
+    template < typename T >
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    parse_text_value( char const *&p, char const *last, T &out )
+    {
+#ifdef __cpp_lib_to_chars
+        auto const  r = std::from_chars( p, last, out );
+
+        if ( r.ec == std::errc::result_out_of_range )
+            throw std::out_of_range{ "Value too large for element type" };
+        if ( r.ec != std::errc{} )
+            return false;
+        p = r.ptr;
+        return true;
+#else
+        char *  stop;
+
+        errno = 0;
+
+        auto const  x = std::strtold( p, &stop );
+
+        if ( stop == p || stop > last )
+            return false;
+        if ( (errno == ERANGE && std::fabs(x) > 1.0L) || (std::isfinite(x) &&
+         std::fabs(x) > std::numeric_limits<T>::max()) )
+            throw std::out_of_range{ "Value too large for element type" };
+        out = static_cast<T>( x );
+        p = stop;
+        return true;
+#endif
+    }
+
+    //! Write one number; returns the end of the written characters.
+    template < typename T >
+    char *  format_text_value( char *first, char *last, T x )
+    {
+#ifdef __cpp_lib_to_chars
+        return std::to_chars( first, last, x ).ptr;
+#else
+        int  written;
+
+        if ( std::is_floating_point<T>::value )
+            written = std::snprintf( first, last - first, "%.*Lg",
+             std::numeric_limits<T>::max_digits10, static_cast<long
+             double>(x) );
+        else if ( std::is_signed<T>::value )
+            written = std::snprintf( first, last - first, "%lld", static_cast<
+             long long>(x) );
+        else
+            written = std::snprintf( first, last - first, "%llu", static_cast<
+             unsigned long long>(x) );
+        return first + written;
+#endif
+    }
+
+    //! The non-blank lines of a text buffer.
+    struct text_lines
+    {
+        explicit  text_lines( std::string const &text )
+        {
+            char const *        p = text.data();
+            char const * const  end = p + text.size();
+
+            while ( p < end )
+            {
+                auto  stop = static_cast<char const *>( std::memchr(p, '\n',
+                 end - p) );
+
+                if ( !stop )
+                    stop = end;
+                if ( std::any_of(p, stop, [](char c){ return
+                 !is_text_delimiter(c); }) )
+                    lines.push_back( {{ p, stop }} );
+                p = stop + 1;
+            }
+        }
+
+        std::vector<std::array<char const *, 2>>  lines;
+    };
+
+    //! Count the values on a line, without converting them.
+    inline
+    std::size_t  count_text_values( char const *p, char const *last )
+    {
+        std::size_t  result = 0u;
+
+        while ( p < last )
+        {
+            while ( p < last && is_text_delimiter(*p) )
+                ++p;
+            if ( p == last )
+                break;
+            ++result;
+            while ( p < last && !is_text_delimiter(*p) )
+                ++p;
+        }
+        return result;
+    }
+
+    /** \brief  Parse lines of text into an array, in row-major index order.
+
+    Every line must have `columns` values.  Line `l` fills the elements with
+    row-major ordinals `[l * columns, (l + 1) * columns)`.  Lines are divided
+    among threads.
+     */
+    template < class MultiArray >
+    void  parse_text_lines( text_lines const &text, std::size_t columns,
+     MultiArray &a, unsigned threads )
+    {
+        typedef typename MultiArray::value_type  value_type;
+        typedef typename MultiArray::size_type    size_type;
+
+        auto const  e = a.extents(), s = a.strides();
+        auto const  first = a.begin();
+        auto const  rank = e.size();
+
+        parallel_chunks( text.lines.size(), thread_count_for(a.required_size(),
+         threads), [&]( std::size_t b, std::size_t stop ){
+            // Find the indexes of the first element of the first line.
+            auto        indexes = e;
+            size_type   offset = 0u, n = b * columns;
+
+            for ( auto  d = rank ; d-- ; )
+            {
+                indexes[ d ] = n % e[ d ];
+                n /= e[ d ];
+                offset += indexes[ d ] * s[ d ];
+            }
+
+            for ( ; b < stop ; ++b )
+            {
+                char const *        p = text.lines[ b ][ 0 ];
+                char const * const  last = text.lines[ b ][ 1 ];
+
+                for ( std::size_t  c = 0u ; c < columns ; ++c )
+                {
+                    while ( p < last && is_text_delimiter(*p) )
+                        ++p;
+
+                    value_type  x;
+
+                    if ( p == last || !parse_text_value(p, last, x) || (p <
+                     last && !is_text_delimiter( *p )) )
+                        throw std::invalid_argument{ "Bad value in text" };
+                    first[ offset ] = x;
+
+                    // Step to the next element in row-major order.
+                    for ( auto  d = rank ; d-- ; )
+                    {
+                        if ( ++indexes[d] < e[d] )
+                        {
+                            offset += s[ d ];
+                            break;
+                        }
+                        offset -= ( e[d] - 1u ) * s[ d ];
+                        indexes[ d ] = 0u;
+                    }
+                }
+                while ( p < last && is_text_delimiter(*p) )
+                    ++p;
+                if ( p != last )
+                    throw std::invalid_argument{ "Ragged lines in text" };
+            }
+        } );
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Text reading function template definitions  ------------------------------//
+
+/** \brief  Read numbers from text into an existing array.
+
+The text is read to its end.  Values are separated by spaces, tabs, commas, or
+semicolons, and blank lines are skipped.  Values fill the array in row-major
+index order (the last index varies fastest), whatever the array's priorities
+are.  Every line must have the same number of values, but lines don't need to
+match any extent, so a vector can be given as a row or as a column.
+
+    \pre  `Container` has random-access iterators.
+    \pre  `T` is an arithmetic type other than `bool`.
+
+    \param is       The stream to read.
+    \param a        The array to fill.
+    \param threads  The maximum number of threads parsing lines.  If zero (the
+                    default), uses the number of hardware threads for large
+                    arrays and one thread for small ones.
+
+    \throws std::invalid_argument  if a value is malformed, the lines have
+                                   differing lengths, or the number of values
+                                   isn't `a.required_size()`.
+    \throws std::out_of_range      if a value doesn't fit in `T`.
+    \throws std::length_error      if `a.size() < a.required_size()`.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+void  read_text( std::istream &is, multiarray<T, Rank, Container, IndexType> &a,
+ unsigned threads = 0u )
+{
+    static_assert( detail::is_text_number<T>::value, "Only numbers, not bool, "
+     "are supported" );
+
+    detail::require_full_size( a );
+
+    auto const                 text = detail::slurp_text( is );
+    detail::text_lines const   lines( text );
+    auto const                 columns = lines.lines.empty() ? 0u :
+     detail::count_text_values( lines.lines[0][0], lines.lines[0][1] );
+
+    if ( columns * lines.lines.size() != a.required_size() )
+        throw std::invalid_argument{ "Wrong number of values in text" };
+    detail::parse_text_lines( lines, columns, a, threads );
+}
+
+/** \overload
+    \details  Views `a` with #make_multiarray_ref, then calls the `multiarray`
+              version.
+ */
+template < typename T, std::size_t ...N >
+inline
+void  read_text( std::istream &is, array_md<T, N...> &a, unsigned threads = 0u )
+{
+    auto  v = make_multiarray_ref( a );
+
+    read_text( is, v, threads );
+}
+
+/** \brief  Read a table of numbers from text, taking the shape from it.
+
+Reads the text as with #read_text, into a new row-major array that has one row
+per non-blank line and one column per value on each line.
+
+    \pre  `T` is an arithmetic type other than `bool`.
+
+    \param is       The stream to read.
+    \param threads  The maximum number of threads parsing lines.  If zero (the
+                    default), chosen automatically.
+
+    \throws std::invalid_argument  if a value is malformed, the lines have
+                                   differing lengths, or there are no values.
+    \throws std::out_of_range      if a value doesn't fit in `T`.
+
+    \returns  The array, with `extents() == {{ lines, values per line }}`.
+ */
+template < typename T >
+multiarray<T, 2u>  read_text( std::istream &is, unsigned threads = 0u )
+{
+    static_assert( detail::is_text_number<T>::value, "Only numbers, not bool, "
+     "are supported" );
+
+    auto const                 text = detail::slurp_text( is );
+    detail::text_lines const   lines( text );
+    auto const                 columns = lines.lines.empty() ? 0u :
+     detail::count_text_values( lines.lines[0][0], lines.lines[0][1] );
+
+    if ( !columns )
+        throw std::invalid_argument{ "No values in text" };
+
+    multiarray<T, 2u>  result( std::vector<T>(columns * lines.lines.size()) );
+
+    result.extents( lines.lines.size(), columns );
+    detail::parse_text_lines( lines, columns, result, threads );
+    return result;
+}
+
+
+//  Text writing function template definitions  ------------------------------//
+
+/** \brief  Write an array as lines of delimited numbers.
+
+Values are written in row-major index order (the last index varies fastest),
+whatever the array's priorities are, so #read_text restores them.  Each line
+gets `per_line` values.  The text is built in a large buffer that is written
+to the stream in blocks.
+
+    \pre  `T` is an arithmetic type other than `bool`.
+
+    \param os         The stream to write to.
+    \param a          The array to write.
+    \param delimiter  The character between values on a line.
+    \param per_line   The number of values per line.  If zero (the default),
+                      the last extent (or 1 for scalars).
+
+    \throws std::length_error  if `a.size() < a.required_size()`.
+    \throws Whatever  the stream throws.
+
+    \returns  `os`.
+ */
+template < typename T, std::size_t Rank, class Container, typename IndexType >
+std::ostream &  write_text( std::ostream &os, multiarray<T, Rank, Container,
+ IndexType> const &a, char delimiter = ' ', std::size_t per_line = 0u )
+{
+    static_assert( detail::is_text_number<T>::value, "Only numbers, not bool, "
+     "are supported" );
+
+    detail::require_full_size( a );
+
+    std::size_t const  flush_at = 1u << 16, widest = 64u;
+    std::string        buffer( flush_at + widest, '\0' );
+    char *             p = &buffer[ 0 ];
+    char const * const start = p;
+    auto const         e = a.extents();
+    std::size_t        column = 0u;
+
+    if ( !per_line )
+        per_line = Rank ? e[ Rank - 1u ] : 1u;
+
+    // Visit elements in row-major order, whatever the memory order is.
+    auto const  s = a.strides();
+    auto const  first = a.begin();
+    auto        indexes = e;
+    std::size_t offset = 0u;
+
+    std::fill( indexes.begin(), indexes.end(), 0u );
+    for ( auto  n = a.required_size() ; n-- ; )
+    {
+        p = detail::format_text_value( p, p + widest, static_cast<T>(
+         first[offset]) );
+        *p++ = ++column == per_line ? '\n' : delimiter;
+        if ( column == per_line )
+            column = 0u;
+        if ( static_cast<std::size_t>(p - start) >= flush_at )
+        {
+            os.write( start, p - start );
+            p = &buffer[ 0 ];
+        }
+        for ( auto  d = Rank ; d-- ; )
+        {
+            if ( ++indexes[d] < e[d] )
+            {
+                offset += s[ d ];
+                break;
+            }
+            offset -= ( e[d] - 1u ) * s[ d ];
+            indexes[ d ] = 0u;
+        }
+    }
+    if ( column )
+        p[ -1 ] = '\n';
+    os.write( start, p - start );
+    return os;
+}
+
+/** \overload
+    \details  Views `a` with #make_multiarray_ref, then calls the `multiarray`
+              version.
+ */
+template < typename T, std::size_t ...N >
+inline
+std::ostream &  write_text( std::ostream &os, array_md<T, N...> const &a, char
+ delimiter = ' ', std::size_t per_line = 0u )
+{ return write_text(os, make_multiarray_ref( a ), delimiter, per_line); }
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_MULTIARRAY_TEXT_HPP
@@ -0,0 +1,287 @@
+//  Boost Multi-dimensional Sparse Table header file  ------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template that finds the least or greatest element in a box
+      of a read-only multi-dimensional array in constant time.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template holding a
+    multi-dimensional sparse table.  For each axis it keeps the extreme element
+    of every run whose length is a power of two, so any box is covered by
+    `2 ** Rank` overlapping precomputed boxes.  The price is memory: about
+    `log2 e0 * ... * log2 eN` copies of the source.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_SPARSE_TABLE_HPP
+#define BOOST_CONTAINER_SPARSE_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+#include "boost/container/multiarray_ref.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Sparse table class template definition  ----------------------------------//
+
+/** \brief  A multi-dimensional sparse table, for box minimums or maximums.
+
+The table is indexed by a level and a position per axis.  The entry for levels
+`(l0, ..., lN)` and positions `(i0, ..., iN)` holds the extreme of the source
+box with `ik <= jk < ik + 2 ** lk`.  Levels of one axis are derived from the
+level below it, with the boxes for the following axes already done, so the
+construction is `O(size * log2 e0 * ... * log2 eN)`.  Each level is split
+among threads.
+
+The source can't be changed afterwards; rebuild the table instead.
+
+    \pre  `Rank > 0`.
+    \pre  `Compare` is a strict weak ordering over `T`.
+
+    \tparam T        The element type.
+    \tparam Rank     The number of index coordinates to locate an element.
+    \tparam Compare  The ordering.  A query returns an element that no other
+                     element in its box compares before.  If not given,
+                     defaults to `std::less<T>`, giving a minimum.
+ */
+template < typename T, std::size_t Rank, class Compare = std::less<T> >
+class sparse_table
+{
+    static_assert( Rank > 0u, "A sparse table needs at least one axis" );
+    static_assert( !std::is_same<T, bool>::value, "Use a wider element type" );
+
+public:
+    // Template parameters
+    //! The element type.  Gives access to its template parameter.
+    typedef T                 value_type;
+    //! The ordering type.  Gives access to its template parameter.
+    typedef Compare           value_compare;
+    //! The number of extents.  Gives access to its template parameter.
+    static constexpr  std::size_t  dimensionality = Rank;
+
+    // Other types
+    //! The type for size-based meta-data.
+    typedef std::size_t                     size_type;
+    //! The type for lists of extents and indexes.
+    typedef std::array<size_type, Rank>     stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Build the table for a source array.
+        \param source   The array to search.  Its index priorities don't
+                        matter.
+        \param compare  The ordering to use.
+        \param threads  The maximum number of threads to use.  If zero (the
+                        default), chosen automatically.
+        \throws std::length_error  if `source.size() <
+                                   source.required_size()`.
+        \throws Whatever  memory allocation or copying elements throws.
+        \post  `extents() == source.extents()`.
+     */
+    template < class Container, typename IndexType >
+    explicit  sparse_table( multiarray<T, Rank, Container, IndexType> const
+     &source, Compare const &compare = Compare(), unsigned threads = 0u )
+      : comp( compare ), e( detail::convert_stats<stats_type>(
+        source.extents()) )
+    {
+        detail::require_full_size( source );
+        layout();
+        source.capply( loader{*this} );
+        for ( auto  d = Rank ; d-- ; )
+            build_along( d, threads );
+    }
+    //! \overload
+    template < std::size_t ...N >
+    explicit  sparse_table( array_md<T, N...> const &source, Compare const
+     &compare = Compare(), unsigned threads = 0u )
+      : sparse_table( make_multiarray_ref(source), compare, threads )
+    { static_assert( sizeof...(N) == Rank, "Wrong number of extents" ); }
+
+    // Observers
+    //! \returns  The extents of the source array.
+    stats_type     extents() const  { return e; }
+    //! \returns  The ordering in use.
+    value_compare  value_comp() const  { return comp; }
+    //! \returns  The number of elements stored, over all levels.
+    size_type      table_size() const  { return entries.size(); }
+
+    /** \brief  Find the extreme element in a box.
+        \param lo  The least index coordinates in the box.
+        \param hi  One past the greatest index coordinates in the box.
+        \throws std::out_of_range  if `lo[k] >= hi[k]` or `hi[k] > extents()[k]`
+                                   for some `k`.  (An empty box has no
+                                   extreme.)
+        \returns  An element at some `(i0, ..., iN)` with `lo[k] <= ik < hi[k]`
+                  that no other element of the box compares before.
+     */
+    value_type const &  query( stats_type const &lo, stats_type const &hi )
+     const
+    {
+        stats_type  base, other;
+
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+        {
+            if ( lo[d] >= hi[d] || hi[d] > e[d] )
+                throw std::out_of_range{ "Box empty or outside of table" };
+
+            auto const  level = floor_log2( hi[d] - lo[d] );
+
+            base[ d ] = level * level_strides[ d ] + lo[ d ] * strides[ d ];
+            other[ d ] = ( hi[d] - (size_type( 1u ) << level) - lo[d] ) *
+             strides[ d ];
+        }
+
+        // The power-of-two boxes from both ends of each axis overlap
+        value_type const *  result = nullptr;
+
+        for ( std::size_t  corner = 0u ; corner < (std::size_t( 1u ) << Rank) ;
+         ++corner )
+        {
+            size_type  o = 0u;
+
+            for ( size_type  d = 0u ; d < Rank ; ++d )
+                o += base[ d ] + ( corner >> d & 1u ? other[d] : 0u );
+            if ( !result || comp(entries[ o ], *result) )
+                result = &entries[ o ];
+        }
+        return *result;
+    }
+
+private:
+    struct loader
+    {
+        sparse_table &  table;
+
+        template < typename ...Indices >
+        void  operator ()( T const &x, Indices ...i ) const
+        {
+            std::array<size_type, Rank> const  ii{ {size_type( i )...} };
+            size_type                          o = 0u;
+
+            for ( size_type  d = 0u ; d < Rank ; ++d )
+                o += ii[ d ] * table.strides[ d ];
+            table.entries[ o ] = x;
+        }
+    };
+
+    static  size_type  floor_log2( size_type x )
+    {
+        size_type  result = 0u;
+
+        while ( x >>= 1 )
+            ++result;
+        return result;
+    }
+
+    // Row-major over (level0, index0, level1, index1, ...)
+    void  layout()
+    {
+        size_type  s = 1u;
+
+        for ( auto  d = Rank ; d-- ; )
+        {
+            if ( !e[d] )
+                throw std::out_of_range{ "Zero extent" };
+            strides[ d ] = s;
+            s *= e[ d ];
+            level_strides[ d ] = s;
+            levels[ d ] = floor_log2( e[d] ) + 1u;
+            s *= levels[ d ];
+        }
+        entries.resize( s );
+    }
+
+    // Fill the levels of one axis.  Earlier axes stay at level zero; all the
+    // levels of later axes are done already and form one contiguous block
+    // per position along this axis.
+    void  build_along( size_type axis, unsigned threads )
+    {
+        size_type  outer = 1u;
+
+        for ( size_type  d = 0u ; d < axis ; ++d )
+            outer *= e[ d ];
+
+        auto const  inner = strides[ axis ];
+        auto const  t = detail::thread_count_for( entries.size(), threads );
+
+        for ( size_type  l = 1u ; l < levels[axis] ; ++l )
+        {
+            auto const  half = size_type( 1u ) << ( l - 1u );
+            auto const  valid = e[ axis ] - 2u * half + 1u;
+
+            detail::parallel_chunks( outer * valid, t, [&]( std::size_t b,
+             std::size_t ee ){
+                for ( auto  q = b ; q < ee ; ++q )
+                {
+                    auto        p = q / valid;
+                    size_type   o = ( q % valid ) * strides[ axis ];
+
+                    for ( auto  d = axis ; d-- ; p /= e[d] )
+                        o += p % e[ d ] * strides[ d ];
+
+                    auto const  to = o + l * level_strides[ axis ];
+                    auto const  from = to - level_strides[ axis ];
+                    auto const  from2 = from + half * strides[ axis ];
+
+                    for ( size_type  x = 0u ; x < inner ; ++x )
+                        entries[ to + x ] = comp( entries[from2 + x],
+                         entries[from + x] ) ? entries[ from2 + x ] : entries[
+                         from + x ];
+                }
+            } );
+        }
+    }
+
+    value_compare           comp;
+    stats_type              e, strides, level_strides, levels;
+    std::vector<value_type> entries;
+};
+
+//! Gives definition to the number of extents.
+template < typename T, std::size_t Rank, class Compare >
+constexpr
+std::size_t  sparse_table<T, Rank, Compare>::dimensionality;
+
+
+//  Sparse table alias template definitions  ---------------------------------//
+
+//! A sparse table for box minimums.
+template < typename T, std::size_t Rank >
+using  range_min_table = sparse_table<T, Rank, std::less<T>>;
+
+//! A sparse table for box maximums.
+template < typename T, std::size_t Rank >
+using  range_max_table = sparse_table<T, Rank, std::greater<T>>;
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_SPARSE_TABLE_HPP
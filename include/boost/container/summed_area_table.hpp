@@ -0,0 +1,349 @@
+//  Boost Multi-dimensional Summed-Area Table header file  -------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  A class template that answers sums over boxes of a multi-dimensional
+      array in constant time.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a class template holding a
+    summed-area (or integral) table of a `multiarray` or `array_md`.  Each entry
+    is the sum of all source elements with no greater index coordinates.  The
+    sum over any axis-aligned box then takes `2 ** Rank` table lookups.  There
+    is also a class template choosing a wider type to accumulate in, so the
+    sums don't overflow as easily as the elements would.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_SUMMED_AREA_TABLE_HPP
+#define BOOST_CONTAINER_SUMMED_AREA_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/array_md.hpp"
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_algorithm.hpp"
+#include "boost/container/multiarray_ref.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Accumulator class template definition  -----------------------------------//
+
+/** \brief  The type to accumulate sums of `T` elements in.
+
+Signed integers sum as `std::intmax_t` and unsigned ones (including `bool`) as
+`std::uintmax_t`.  Floating-point types sum as at least `double`.  Other types
+sum as themselves.  Specialize this template to change the choice for a
+user-defined type.
+
+    \tparam T  The element type.
+ */
+template < typename T >
+struct summed_area_accumulator
+{
+    //! The chosen accumulation type.
+    typedef typename std::conditional<std::is_integral<T>::value, typename
+     std::conditional<std::is_signed<T>::value, std::intmax_t,
+     std::uintmax_t>::type, typename std::conditional<
+     std::is_floating_point<T>::value, typename std::common_type<T,
+     double>::type, T>::type>::type  type;
+};
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Copies elements into a row-major table, for `multiarray::apply`.
+    template < typename Table >
+    struct sat_loader
+    {
+        Table &  table;
+
+        template < typename T, typename ...Indices >
+        void  operator ()( T const &x, Indices ...i ) const
+        { table( i... ) = static_cast<typename Table::value_type>( x ); }
+    };
+
+}  // namespace detail
+//! \endcond
+
+
+//  Summed-area table class template definition  -----------------------------//
+
+/** \brief  A summed-area table of a multi-dimensional array.
+
+The table has the same extents as its source.  Its entry at `(i0, ..., iN)`
+is the sum of the source elements at `(j0, ..., jN)` for all `jk <= ik`.  It is
+built with one #inclusive_scan_along pass per axis, so the work is split among
+threads and each pass reads memory sequentially.
+
+After construction, the table no longer refers to the source.  If the source
+changes, #update adjusts the table from the new values of the changed box.
+
+    \pre  `Rank > 0`.
+    \pre  The elements are summable, with subtraction as the inverse of
+          addition, when converted to `Accumulator`.
+
+    \tparam T            The source element type.
+    \tparam Rank         The number of index coordinates to locate an element.
+    \tparam Accumulator  The type of the sums.  If not given, defaults to the
+                         type #summed_area_accumulator chooses.
+ */
+template < typename T, std::size_t Rank, typename Accumulator = typename
+ summed_area_accumulator<T>::type >
+class summed_area_table
+{
+    static_assert( Rank > 0u, "A summed-area table needs at least one axis" );
+
+public:
+    // Template parameters
+    //! The source element type.  Gives access to its template parameter.
+    typedef T                 element_type;
+    //! The sum type.  Gives access to its template parameter.
+    typedef Accumulator        value_type;
+    //! The number of extents.  Gives access to its template parameter.
+    static constexpr  std::size_t  dimensionality = Rank;
+
+    // Other types
+    //! The type of the table of sums.
+    typedef multiarray<value_type, Rank>      table_type;
+    //! The type for size-based meta-data.
+    typedef typename table_type::size_type     size_type;
+    //! The type for lists of extents and indexes.
+    typedef typename table_type::stats_type   stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Build the table for a source array.
+        \param source   The array to sum.  Its index priorities don't matter.
+        \param threads  The maximum number of threads to use.  If zero (the
+                        default), chosen automatically.
+        \throws std::length_error  if `source.size() <
+                                   source.required_size()`.
+        \throws Whatever  #inclusive_scan_along throws, or memory allocation.
+        \post  `extents() == source.extents()`.
+     */
+    template < class Container, typename IndexType >
+    explicit  summed_area_table( multiarray<T, Rank, Container, IndexType> const
+     &source, unsigned threads = 0u )
+      : table( std::vector<value_type>(source.required_size()) )
+    {
+        detail::require_full_size( source );
+        table.extents( detail::convert_stats<stats_type>(source.extents()) );
+        source.capply( detail::sat_loader<table_type>{table} );
+        scan_all( table, threads );
+    }
+    //! \overload
+    template < std::size_t ...N >
+    explicit  summed_area_table( array_md<T, N...> const &source, unsigned
+     threads = 0u )
+      : summed_area_table( make_multiarray_ref(source), threads )
+    { static_assert( sizeof...(N) == Rank, "Wrong number of extents" ); }
+
+    // Observers
+    //! \returns  The extents of the source array.
+    stats_type           extents() const  { return table.extents(); }
+    //! \returns  The table of sums, in row-major order.
+    table_type const &  entries() const  { return table; }
+
+    /** \brief  Sum the source elements in a box.
+        \param lo  The least index coordinates in the box.
+        \param hi  One past the greatest index coordinates in the box.
+        \throws std::out_of_range  if `lo[k] > hi[k]` or `hi[k] > extents()[k]`
+                                   for some `k`.
+        \returns  The sum of source elements at `(i0, ..., iN)` for all
+                  `lo[k] <= ik < hi[k]`.  That is zero if the box is empty.
+     */
+    value_type  sum( stats_type const &lo, stats_type const &hi ) const
+    {
+        auto const  e = table.extents();
+
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+            if ( lo[d] > hi[d] || hi[d] > e[d] )
+                throw std::out_of_range{ "Box outside of table" };
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+            if ( lo[d] == hi[d] )
+                return value_type();
+        return unchecked_sum( lo, hi );
+    }
+
+    /** \brief  Adjust the table for a changed box of source elements.
+
+    The sums are corrected with the differences between the new values and the
+    old ones (recovered from the table itself).  The differences are summed
+    into a table for the box, which is then added to every entry on or after
+    the box's least corner.  No other source values are needed.
+
+        \param lo       The least index coordinates of the changed box.
+        \param values   The new values of the box's elements.  Its extents are
+                        the extents of the box.
+        \param threads  The maximum number of threads to use.  If zero (the
+                        default), chosen automatically.
+        \throws std::out_of_range  if the box doesn't fit in the table.
+        \throws std::length_error  if `values.size() <
+                                   values.required_size()`.
+        \throws Whatever  #inclusive_scan_along throws, or memory allocation.
+        \post  The table is what would be built for the source with the box's
+               elements replaced.
+     */
+    template < class Container, typename IndexType >
+    void  update( stats_type const &lo, multiarray<T, Rank, Container,
+     IndexType> const &values, unsigned threads = 0u )
+    {
+        auto const  e = table.extents();
+        auto const  box = detail::convert_stats<stats_type>(
+         values.extents() );
+
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+            if ( lo[d] > e[d] || box[d] > e[d] - lo[d] )
+                throw std::out_of_range{ "Box outside of table" };
+        detail::require_full_size( values );
+
+        table_type  deltas( std::vector<value_type>(values.required_size()) );
+
+        deltas.extents( box );
+        values.capply( delta_loader{*this, deltas, lo} );
+        scan_all( deltas, threads );
+
+        // Add the clamped sums of the differences to the later entries.
+        auto const  s = table.strides(), ds = deltas.strides();
+        auto const  first = table.begin();
+        auto        i = lo;
+
+        do
+        {
+            size_type  offset = 0u, d_offset = 0u;
+
+            for ( size_type  d = 0u ; d < Rank ; ++d )
+            {
+                offset += i[ d ] * s[ d ];
+                d_offset += std::min( i[d] - lo[d], box[d] - 1u ) * ds[ d ];
+            }
+            first[ offset ] += deltas.begin()[ d_offset ];
+        } while ( next_index(i, lo, e) );
+    }
+    //! \overload
+    template < std::size_t ...N >
+    void  update( stats_type const &lo, array_md<T, N...> const &values,
+     unsigned threads = 0u )
+    {
+        static_assert( sizeof...(N) == Rank, "Wrong number of extents" );
+
+        update( lo, make_multiarray_ref(values), threads );
+    }
+
+private:
+    // Computes differences from the old values, for "multiarray::apply".
+    struct delta_loader
+    {
+        summed_area_table const &  self;
+        table_type &               deltas;
+        stats_type const &         lo;
+
+        template < typename ...Indices >
+        void  operator ()( T const &x, Indices ...i ) const
+        {
+            stats_type const  at{ {static_cast<size_type>(i)...} };
+            stats_type        b, e;
+
+            for ( size_type  d = 0u ; d < Rank ; ++d )
+                e[ d ] = 1u + ( b[d] = lo[d] + at[d] );
+            deltas( i... ) = static_cast<value_type>( x ) -
+             self.unchecked_sum( b, e );
+        }
+    };
+
+    // Turn elements into their prefix sums along every axis.
+    static  void  scan_all( table_type &t, unsigned threads )
+    {
+        for ( size_type  d = 0u ; d < Rank ; ++d )
+            inclusive_scan_along( t, d, std::plus<value_type>{}, threads );
+    }
+
+    // Step through [lo, hi) in row-major order; false after the last one.
+    static  bool  next_index( stats_type &i, stats_type const &lo, stats_type
+     const &hi )
+    {
+        for ( auto  d = Rank ; d-- ; )
+        {
+            if ( ++i[d] < hi[d] )
+                return true;
+            i[ d ] = lo[ d ];
+        }
+        return false;
+    }
+
+    // Inclusion-exclusion over the box's corners, for a non-empty box.
+    value_type  unchecked_sum( stats_type const &lo, stats_type const &hi )
+     const
+    {
+        auto const  s = table.strides();
+        auto const  first = table.begin();
+        value_type  result = value_type();
+
+        for ( std::size_t  corner = 0u ; corner < (std::size_t( 1u ) << Rank) ;
+         ++corner )
+        {
+            size_type  offset = 0u;
+            bool       negate = false, skip = false;
+
+            for ( size_type  d = 0u ; d < Rank && !skip ; ++d )
+                if ( corner >> d & 1u )
+                {
+                    skip = !lo[ d ];
+                    offset += ( lo[d] - !skip ) * s[ d ];
+                    negate = !negate;
+                }
+                else
+                    offset += ( hi[d] - 1u ) * s[ d ];
+            if ( skip )
+                continue;
+            if ( negate )
+                result = result - first[ offset ];
+            else
+                result = result + first[ offset ];
+        }
+        return result;
+    }
+
+    table_type  table;
+};
+
+//! Gives definition to the number of extents.
+template < typename T, std::size_t Rank, typename Accumulator >
+constexpr
+std::size_t  summed_area_table<T, Rank, Accumulator>::dimensionality;
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_SUMMED_AREA_TABLE_HPP
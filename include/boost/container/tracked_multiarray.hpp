@@ -0,0 +1,448 @@
+//  Boost Dirty-Tracking Multi-dimensional Array header file  ----------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+/** \file
+    \brief  Class templates that track which blocks of a multi-dimensional
+      array have been changed, for incremental synchronization.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of a contiguous container class
+    template that flags fixed-size blocks of elements whenever they're reached
+    through mutable access, and of a `multiarray` using that container.  The
+    changed blocks can be listed, visited, or written to a stream, then the
+    flags cleared at a checkpoint.  Another array can read that stream to
+    catch up, so the cost of synchronizing follows the amount of change.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_CONTAINER_TRACKED_MULTIARRAY_HPP
+#define BOOST_CONTAINER_TRACKED_MULTIARRAY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/multiarray.hpp"
+
+
+namespace boost
+{
+namespace container
+{
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! A copyable flag that threads may set concurrently.
+    class dirty_flag
+    {
+    public:
+        dirty_flag( bool v = false ) noexcept  : f( v )  {}
+        dirty_flag( dirty_flag const &o ) noexcept  : f( o.get() )  {}
+        dirty_flag &  operator =( dirty_flag const &o ) noexcept
+        { f.store(o.get(), std::memory_order_relaxed); return *this; }
+
+        bool    get() const noexcept
+        { return f.load( std::memory_order_relaxed ); }
+        // Skip the store when already set, to not dirty the cache line.
+        void    set() noexcept
+        { if ( !get() ) f.store(true, std::memory_order_relaxed); }
+        void  reset() noexcept
+        { f.store( false, std::memory_order_relaxed ); }
+
+    private:
+        std::atomic<bool>  f;
+    };
+
+    //! Mutable iterator that flags the block of each element it reaches.
+    template < typename T, std::size_t BlockSize >
+    class dirty_marking_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag  iterator_category;
+        typedef T                                        value_type;
+        typedef std::ptrdiff_t                      difference_type;
+        typedef T *                                         pointer;
+        typedef T &                                       reference;
+
+        dirty_marking_iterator() noexcept
+          : p( nullptr ), base( nullptr ), flags( nullptr )
+        {}
+        dirty_marking_iterator( T *at, T *first, dirty_flag *f ) noexcept
+          : p( at ), base( first ), flags( f )
+        {}
+
+        // Reaching an element for mutable access flags its block.
+        reference  operator *() const
+        { flags[ (p - base) / BlockSize ].set(); return *p; }
+        pointer   operator ->() const  { return &**this; }
+        reference  operator []( difference_type n ) const
+        { return *(*this + n); }
+
+        dirty_marking_iterator &  operator ++() noexcept  { ++p; return *this; }
+        dirty_marking_iterator &  operator --() noexcept  { --p; return *this; }
+        dirty_marking_iterator  operator ++( int ) noexcept
+        { auto  t = *this; ++p; return t; }
+        dirty_marking_iterator  operator --( int ) noexcept
+        { auto  t = *this; --p; return t; }
+        dirty_marking_iterator &  operator +=( difference_type n ) noexcept
+        { p += n; return *this; }
+        dirty_marking_iterator &  operator -=( difference_type n ) noexcept
+        { p -= n; return *this; }
+
+        friend  dirty_marking_iterator  operator +( dirty_marking_iterator i,
+         difference_type n ) noexcept  { return i += n; }
+        friend  dirty_marking_iterator  operator +( difference_type n,
+         dirty_marking_iterator i ) noexcept  { return i += n; }
+        friend  dirty_marking_iterator  operator -( dirty_marking_iterator i,
+         difference_type n ) noexcept  { return i -= n; }
+        friend  difference_type  operator -( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p - r.p; }
+
+        friend  bool  operator ==( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p == r.p; }
+        friend  bool  operator !=( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p != r.p; }
+        friend  bool  operator <( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p < r.p; }
+        friend  bool  operator >( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p > r.p; }
+        friend  bool  operator <=( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p <= r.p; }
+        friend  bool  operator >=( dirty_marking_iterator const &l,
+         dirty_marking_iterator const &r ) noexcept  { return l.p >= r.p; }
+
+    private:
+        T *           p;
+        T *           base;
+        dirty_flag *  flags;
+    };
+
+    //! Stream a fixed-width integer, in native byte order.
+    inline
+    void  write_u64( std::ostream &os, std::uint64_t x )
+    { os.write(reinterpret_cast<char const *>( &x ), sizeof( x )); }
+
+    //! Read a fixed-width integer, in native byte order.
+    inline
+    std::uint64_t  read_u64( std::istream &is )
+    {
+        std::uint64_t  x;
+
+        if ( !is.read(reinterpret_cast<char *>( &x ), sizeof( x )) )
+            throw std::invalid_argument{ "Truncated block stream" };
+        return x;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Dirty-tracking vector class template definition  -------------------------//
+
+/** \brief  A contiguous container that flags blocks reached for writing.
+
+The elements are split into blocks of `BlockSize` consecutive elements (the
+last block may be shorter).  Each block has a flag that is set whenever one of
+its elements is reached through a mutable iterator, including the ones that
+`multiarray` uses for mutable `operator ()`, `at`, `operator []`, `fill`, and
+`apply`.  The flag is set even if the element is only read that way, so
+tracking is conservative.  Immutable access never sets flags.  Setting flags
+from several threads at once is safe.
+
+A mutable call of #data can't be tracked, so it flags every block.
+
+    \pre  `T` is trivially copyable, for the stream functions.
+
+    \tparam T          The element type.
+    \tparam BlockSize  The number of elements per block.  Must be a power of 2.
+ */
+template < typename T, std::size_t BlockSize = 1024u >
+class dirty_tracking_vector
+{
+    static_assert( BlockSize && !(BlockSize & (BlockSize - 1u)),
+     "Block size must be a power of 2" );
+
+public:
+    // Container types
+    typedef T                                                 value_type;
+    typedef T &                                                reference;
+    typedef T const &                                    const_reference;
+    typedef T *                                                  pointer;
+    typedef T const *                                      const_pointer;
+    typedef detail::dirty_marking_iterator<T, BlockSize>         iterator;
+    typedef const_pointer                                 const_iterator;
+    typedef std::size_t                                        size_type;
+    typedef std::ptrdiff_t                               difference_type;
+
+    //! The number of elements per block.  Gives access to its template
+    //! parameter.
+    static constexpr  size_type  block_size = BlockSize;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    //! Default constructor; no elements.
+    dirty_tracking_vector() = default;
+    //! Create `n` copies of `v`, with all blocks flagged.
+    explicit  dirty_tracking_vector( size_type n, T const &v = T() )
+      : elements( n, v ), flags( blocks_for(n), detail::dirty_flag(true) )
+    {}
+    //! Take the elements of a `std::vector`, with all blocks flagged.
+    explicit  dirty_tracking_vector( std::vector<T> v )
+      : elements( std::move(v) ),
+        flags( blocks_for(elements.size()), detail::dirty_flag(true) )
+    {}
+
+    // Container interface
+    //! \returns  A flagging iterator to the first element.
+          iterator   begin()
+    { return iterator( elements.data(), elements.data(), flags.data() ); }
+    //! \returns  An iterator to the first element.
+    const_iterator   begin() const  { return elements.data(); }
+    //! \returns  A flagging iterator past the last element.
+          iterator     end()  { return begin() + elements.size(); }
+    //! \returns  An iterator past the last element.
+    const_iterator     end() const  { return begin() + elements.size(); }
+    //! \returns  `begin() const`.
+    const_iterator  cbegin() const  { return begin(); }
+    //! \returns  `end() const`.
+    const_iterator    cend() const  { return end(); }
+
+    //! \returns  The address of the elements.  Flags every block.
+          pointer    data()  { mark_all_dirty(); return elements.data(); }
+    //! \returns  The address of the elements.
+    const_pointer    data() const  { return elements.data(); }
+
+    //! \returns  The number of elements.
+    size_type        size() const noexcept  { return elements.size(); }
+    //! \returns  `size() == 0`.
+    bool            empty() const noexcept  { return elements.empty(); }
+
+    //! Exchange elements and flags with another object.
+    void  swap( dirty_tracking_vector &other ) noexcept
+    { elements.swap(other.elements); flags.swap(other.flags); }
+
+    // Tracking
+    //! \returns  The number of blocks.
+    size_type  block_count() const noexcept  { return flags.size(); }
+    //! \returns  Whether block `b` has been flagged since the last clearing.
+    bool          is_dirty( size_type b ) const  { return flags[b].get(); }
+    //! \returns  The indexes of the flagged blocks, in increasing order.
+    std::vector<size_type>  dirty_blocks() const
+    {
+        std::vector<size_type>  result;
+
+        for ( size_type  b = 0u ; b < flags.size() ; ++b )
+            if ( flags[b].get() )
+                result.push_back( b );
+        return result;
+    }
+
+    //! Unflag every block, like at a checkpoint.
+    void  clear_dirty() noexcept  { for ( auto &f : flags ) f.reset(); }
+    //! Flag every block.
+    void  mark_all_dirty() noexcept  { for ( auto &f : flags ) f.set(); }
+
+    /** \brief  Call a function on each flagged block.
+        \param f  Called as `f( b, first, last )` for each flagged block `b`,
+                  in increasing order, where `[first, last)` are its elements.
+     */
+    template < typename Function >
+    void  for_each_dirty_block( Function &&f ) const
+    {
+        for ( size_type  b = 0u ; b < flags.size() ; ++b )
+            if ( flags[b].get() )
+                f( b, begin() + b * BlockSize, begin() + std::min(size(), (b +
+                 1u) * BlockSize) );
+    }
+
+    /** \brief  Write the flagged blocks to a binary stream.
+
+    The format is the block count, then for each block its index, its length,
+    and its element bytes.  The counts are 64-bit, and everything uses the
+    native byte order, so the reader must be on the same kind of platform.
+    The flags aren't cleared; call #clear_dirty once the write is committed.
+
+        \param os  The stream to write to.
+        \returns  The number of blocks written.
+     */
+    size_type  write_dirty_blocks( std::ostream &os ) const
+    {
+        static_assert( std::is_trivially_copyable<T>::value,
+         "Elements can't be streamed as bytes" );
+
+        auto const  dirty = dirty_blocks();
+
+        detail::write_u64( os, dirty.size() );
+        for ( auto const  b : dirty )
+        {
+            auto const  first = b * BlockSize;
+            auto const  length = std::min( size(), first + BlockSize ) - first;
+
+            detail::write_u64( os, b );
+            detail::write_u64( os, length );
+            os.write( reinterpret_cast<char const *>(elements.data() + first),
+             static_cast<std::streamsize>(length * sizeof( T )) );
+        }
+        return dirty.size();
+    }
+
+    /** \brief  Apply blocks written by #write_dirty_blocks.
+
+    Each block read replaces the matching elements, and is flagged, so changes
+    can be relayed onward.
+
+        \param is  The stream to read from.
+        \throws std::invalid_argument  if the stream ends early, or a block
+                  doesn't match this object's block layout.  Blocks before the
+                  bad one stay applied.
+        \returns  The number of blocks read.
+     */
+    size_type  read_blocks( std::istream &is )
+    {
+        static_assert( std::is_trivially_copyable<T>::value,
+         "Elements can't be streamed as bytes" );
+
+        auto const  count = detail::read_u64( is );
+
+        for ( std::uint64_t  i = 0u ; i < count ; ++i )
+        {
+            auto const  b = detail::read_u64( is );
+            auto const  length = detail::read_u64( is );
+
+            if ( b >= flags.size() || length != std::min<std::uint64_t>(size(),
+             (b + 1u) * BlockSize) - b * BlockSize )
+                throw std::invalid_argument{ "Block doesn't match layout" };
+            if ( !is.read(reinterpret_cast<char *>( elements.data() + b *
+             BlockSize ), static_cast<std::streamsize>( length * sizeof(T) )) )
+                throw std::invalid_argument{ "Truncated block stream" };
+            flags[ b ].set();
+        }
+        return static_cast<size_type>( count );
+    }
+
+private:
+    static  size_type  blocks_for( size_type n )
+    { return n / BlockSize + !!( n % BlockSize ); }
+
+    std::vector<T>                   elements;
+    std::vector<detail::dirty_flag>  flags;
+};
+
+//! Gives definition to the block size.
+template < typename T, std::size_t BlockSize >
+constexpr  std::size_t  dirty_tracking_vector<T, BlockSize>::block_size;
+
+//! Swap routine for `dirty_tracking_vector`.
+template < typename T, std::size_t BlockSize >
+inline
+void  swap( dirty_tracking_vector<T, BlockSize> &a, dirty_tracking_vector<T,
+ BlockSize> &b ) noexcept
+{ a.swap(b); }
+
+
+//  Dirty-tracking multi-dimensional array class template definition  --------//
+
+/** \brief  A `multiarray` that records which blocks of its elements change.
+
+This class template provides the #multiarray interface over a
+#dirty_tracking_vector, and re-exposes the tracking interface.  Blocks are
+ranges of consecutive elements in memory order, so the index priorities decide
+which elements share a block.
+
+A new array starts with every block flagged, so the first synchronization
+sends everything.
+
+    \tparam T          The element type.
+    \tparam Rank       The number of index coordinates to access an element.
+    \tparam BlockSize  The number of elements per block.  Must be a power of 2.
+ */
+template < typename T, std::size_t Rank, std::size_t BlockSize = 1024u >
+class tracked_multiarray
+    : public multiarray<T, Rank, dirty_tracking_vector<T, BlockSize>>
+{
+    // Base type
+    using base_type = multiarray<T, Rank, dirty_tracking_vector<T, BlockSize>>;
+
+public:
+    // Other types
+    using typename base_type::container_type;
+    using typename base_type::size_type;
+    using typename base_type::stats_type;
+
+    // Lifetime management
+    // (Use automatically-defined copy-ctr, move-ctr, and destructor)
+    /** \brief  Create an array of the given shape, in row-major order.
+        \param e  The extents.
+        \param v  The value of every element.
+        \throws Whatever  #multiarray::extents throws, or memory allocation.
+        \post  `extents() == e && size() == required_size()`.
+        \post  Every block is flagged.
+     */
+    tracked_multiarray( stats_type const &e, T const &v )
+    { this->extents( e ); c = container_type( this->required_size(), v ); }
+
+    // Tracking
+    //! \returns  The number of blocks.
+    size_type  block_count() const noexcept  { return c.block_count(); }
+    //! \returns  Whether block `b` has been flagged since the last clearing.
+    bool          is_dirty( size_type b ) const  { return c.is_dirty(b); }
+    //! \returns  The indexes of the flagged blocks, in increasing order.
+    std::vector<size_type>  dirty_blocks() const  { return c.dirty_blocks(); }
+    //! Unflag every block, like at a checkpoint.
+    void  clear_dirty() noexcept  { c.clear_dirty(); }
+    //! Flag every block.
+    void  mark_all_dirty() noexcept  { c.mark_all_dirty(); }
+    //! \see  #dirty_tracking_vector::for_each_dirty_block
+    template < typename Function >
+    void  for_each_dirty_block( Function &&f ) const
+    { c.for_each_dirty_block(std::forward<Function>( f )); }
+    //! \see  #dirty_tracking_vector::write_dirty_blocks
+    size_type  write_dirty_blocks( std::ostream &os ) const
+    { return c.write_dirty_blocks(os); }
+    //! \pre  `*this` has the same extents and priorities as the writer.
+    //! \see  #dirty_tracking_vector::read_blocks
+    size_type  read_blocks( std::istream &is )  { return c.read_blocks(is); }
+
+protected:
+    using base_type::c;
+};
+
+/** \brief  Swap routine for `tracked_multiarray`.
+    \param a  The first object to have its state exchanged.
+    \param b  The second object to have its state exchanged.
+ */
+template < typename T, std::size_t Rank, std::size_t BlockSize >
+inline
+void  swap( tracked_multiarray<T, Rank, BlockSize> &a, tracked_multiarray<T,
+ Rank, BlockSize> &b )
+{ a.swap(b); }
+
+}  // namespace container
+}  // namespace boost
+
+
+#endif // BOOST_CONTAINER_TRACKED_MULTIARRAY_HPP
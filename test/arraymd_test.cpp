@@ -1589,5 +1589,174 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_nesting, T, test_types)
     BOOST_CHECK_EQUAL( b5()[2][1], t6()[2][1] );
 }
 
+BOOST_AUTO_TEST_CASE( test_reshape )
+{
+    using boost::container::array_md;
+    using boost::container::array_md_ref;
+    using boost::container::reshape;
+    using std::is_same;
+
+    array_md<int, 6, 4>  sample;
+
+    for ( int  i = 0 ; i < 24 ; ++i )
+        sample.data()[ i ] = i;
+
+    // Same storage, new shapes
+    auto  flat = reshape<24>( sample );
+    auto  cube = reshape<2, 3, 4>( sample );
+
+    BOOST_REQUIRE( (is_same<decltype(flat), array_md_ref<int, 24>>::value) );
+    BOOST_REQUIRE( (is_same<decltype(cube), array_md_ref<int, 2, 3, 4>>::value)
+     );
+    BOOST_CHECK( flat.data() == sample.data() );
+    BOOST_CHECK_EQUAL( flat.size(), 24u );
+    BOOST_CHECK_EQUAL( flat[13], sample[3][1] );
+    BOOST_CHECK_EQUAL( cube[1][2][3], 23 );
+    BOOST_CHECK_EQUAL( cube(1, 0, 2), sample(3, 2) );
+    BOOST_CHECK( std::equal(cube.begin(), cube.end(), sample.begin()) );
+
+    // Writes are shared
+    cube[ 0 ][ 1 ][ 0 ] = -4;
+    BOOST_CHECK_EQUAL( sample[1][0], -4 );
+    BOOST_CHECK_EQUAL( flat[4], -4 );
+
+    // Immutable access, and round trips
+    auto const &  cs = sample;
+    auto const    back = reshape<6, 4>( reshape<4, 6>(cs) );
+
+    BOOST_REQUIRE( (is_same<decltype(back), array_md_ref<int const, 6, 4>
+     const>::value) );
+    BOOST_CHECK( back.data() == cs.data() );
+    BOOST_CHECK_EQUAL( back[1][0], -4 );
+    BOOST_CHECK( (is_same<decltype(back[1]), array_md_ref<int const,
+     4>>::value) );
+    BOOST_CHECK( (is_same<decltype(cube.begin()), int *>::value) );
+    BOOST_CHECK( (is_same<decltype(static_cast<decltype(cube) const
+     &>(cube)[0][0][0]), int const &>::value) );
+
+    array_md<long, 1>  single{ {7L} };
+
+    BOOST_CHECK_EQUAL( reshape<>(single)(), 7L );
+}
+
+BOOST_AUTO_TEST_CASE( test_transpose )
+{
+    using boost::container::array_md;
+    using boost::container::transpose;
+    using boost::container::transpose_in_place;
+    using std::is_same;
+    using std::size_t;
+
+    // Small shapes (unrolled)
+    array_md<int, 2, 3, 4>  small;
+
+    for ( int  i = 0 ; i < 24 ; ++i )
+        small.data()[ i ] = i;
+
+    auto const  st = transpose<2, 0, 1>( small );
+    auto const  same = transpose<0, 1, 2>( small );
+
+    BOOST_REQUIRE( (is_same<decltype(st), array_md<int, 4, 2, 3> const>::value)
+     );
+    for ( size_t  i = 0u ; i < 4u ; ++i )
+        for ( size_t  j = 0u ; j < 2u ; ++j )
+            for ( size_t  k = 0u ; k < 3u ; ++k )
+                BOOST_CHECK_EQUAL( st(i, j, k), small(j, k, i) );
+    BOOST_CHECK( same == small );
+    BOOST_CHECK( (transpose<1, 2, 0>( st ) == small) );
+
+    // Large shapes (tiled), including ragged tiles and a fixed innermost axis
+    array_md<long, 3, 37, 21>  large;
+
+    for ( size_t  i = 0u ; i < large.size() ; ++i )
+        large.data()[ i ] = static_cast<long>( i );
+
+    auto const  lt = transpose<2, 0, 1>( large );
+    auto const  lk = transpose<1, 0, 2>( large );
+
+    BOOST_REQUIRE( (is_same<decltype(lt), array_md<long, 21, 3, 37> const>::
+     value) );
+    for ( size_t  i = 0u ; i < 3u ; ++i )
+        for ( size_t  j = 0u ; j < 37u ; ++j )
+            for ( size_t  k = 0u ; k < 21u ; ++k )
+            {
+                BOOST_CHECK_EQUAL( lt(k, i, j), large(i, j, k) );
+                BOOST_CHECK_EQUAL( lk(j, i, k), large(i, j, k) );
+            }
+
+    // Square matrices, both ways
+    array_md<int, 40, 40>  square;
+
+    for ( int  i = 0 ; i < 1600 ; ++i )
+        square.data()[ i ] = i;
+
+    auto const  sq = transpose<1, 0>( square );
+
+    transpose_in_place( square );
+    BOOST_CHECK( sq == square );
+    BOOST_CHECK_EQUAL( square(3, 38), 38 * 40 + 3 );
+    transpose_in_place( square );
+    BOOST_CHECK_EQUAL( square(3, 38), 3 * 40 + 38 );
+
+    array_md<double, 1, 1>  tiny{ {2.5} };
+
+    transpose_in_place( tiny );
+    BOOST_CHECK_EQUAL( tiny(0, 0), 2.5 );
+}
+
+BOOST_AUTO_TEST_CASE( test_concat_and_stack )
+{
+    using boost::container::array_md;
+    using boost::container::concat;
+    using boost::container::stack;
+    using std::is_same;
+    using std::size_t;
+
+    array_md<int, 2, 3>  a{ {1, 2, 3, 4, 5, 6} };
+    array_md<int, 1, 3>  b{ {7, 8, 9} };
+    array_md<int, 2, 2>  c{ {10, 11, 12, 13} };
+
+    // Along the leading axis
+    auto const  ab = concat<0>( a, b );
+
+    BOOST_REQUIRE( (is_same<decltype(ab), array_md<int, 3, 3> const>::value) );
+    BOOST_CHECK( (ab == array_md<int, 3, 3>{ {1, 2, 3, 4, 5, 6, 7, 8, 9} }) );
+
+    // Along an inner axis, with more than two arrays
+    auto const  aca = concat<1>( a, c, a );
+
+    BOOST_REQUIRE( (is_same<decltype(aca), array_md<int, 2, 8> const>::value) );
+    BOOST_CHECK( (aca == array_md<int, 2, 8>{ {1, 2, 3, 10, 11, 1, 2, 3, 4, 5,
+     6, 12, 13, 4, 5, 6} }) );
+    BOOST_CHECK( concat<1>(a) == a );
+
+    // Higher ranks
+    array_md<long, 2, 2, 2>  cube;
+
+    for ( long  i = 0 ; i < 8 ; ++i )
+        cube.data()[ i ] = i;
+
+    auto const  wide = concat<2>( cube, cube );
+
+    for ( size_t  i = 0u ; i < 2u ; ++i )
+        for ( size_t  j = 0u ; j < 2u ; ++j )
+            for ( size_t  k = 0u ; k < 4u ; ++k )
+                BOOST_CHECK_EQUAL( wide(i, j, k), cube(i, j, k % 2u) );
+
+    // Stacking
+    auto const  s = stack( a, a, a );
+
+    BOOST_REQUIRE( (is_same<decltype(s), array_md<int, 3, 2, 3> const>::value)
+     );
+    BOOST_CHECK_EQUAL( s(2, 0, 0), 1 );
+    BOOST_CHECK_EQUAL( s(1, 1, 2), 6 );
+
+    array_md<double>  x{ 1.5 }, y{ -2.0 };
+    auto const        xy = stack( x, y );
+
+    BOOST_REQUIRE( (is_same<decltype(xy), array_md<double, 2> const>::value) );
+    BOOST_CHECK_EQUAL( xy[1], -2.0 );
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()  // test_array_md_operations
@@ -0,0 +1,200 @@
+//  Boost Batched Small Matrix unit test program file  ----------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/batched_matrix.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+    typedef boost::container::array_md<double, 3, 3>  matrix3;
+
+    // Distinct, well-conditioned test matrices
+    matrix3  sample( std::size_t i )
+    {
+        matrix3  result;
+
+        for ( std::size_t  r = 0u ; r < 3u ; ++r )
+            for ( std::size_t  c = 0u ; c < 3u ; ++c )
+                result[ r ][ c ] = double( (i * 7u + r * 5u + c * 3u) % 11u ) /
+                 4. + ( r == c ? 4. : 0. );
+        return result;
+    }
+
+    double  scalar_determinant( matrix3 const &m )
+    {
+        return m[0][0] * ( m[1][1] * m[2][2] - m[1][2] * m[2][1] ) - m[0][1] *
+         ( m[1][0] * m[2][2] - m[1][2] * m[2][0] ) + m[0][2] * ( m[1][0] *
+         m[2][1] - m[1][1] * m[2][0] );
+    }
+}
+
+
+// Unit tests for batched small matrices  ------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_batched_matrix_basics )
+
+BOOST_AUTO_TEST_CASE( test_batched_layout )
+{
+    using boost::container::batched_matrix;
+
+    // A partial last group
+    std::vector<matrix3>              source;
+
+    for ( std::size_t  i = 0u ; i < 11u ; ++i )
+        source.push_back( sample(i) );
+
+    batched_matrix<double, 3, 3, 4>  batch( source.begin(), source.end() );
+
+    BOOST_CHECK_EQUAL( batch.size(), 11u );
+    BOOST_CHECK_EQUAL( batch.group_count(), 3u );
+    BOOST_CHECK( batch.get(10) == source[10] );
+    BOOST_CHECK_EQUAL( batch.group_data(1)[5 * 4 + 2], source[6][1][2] );
+    batch( 3, 2, 1 ) = -1.;
+    BOOST_CHECK_EQUAL( batch.get(3)[2][1], -1. );
+    BOOST_CHECK_THROW( batch.get(11), std::out_of_range );
+    BOOST_CHECK_THROW( batch.set(11, source[0]), std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE( test_batched_algebra )
+{
+    using boost::container::batched_matrix;
+    using std::size_t;
+
+    std::vector<matrix3>  source;
+
+    for ( size_t  i = 0u ; i < 37u ; ++i )
+        source.push_back( sample(i) );
+
+    batched_matrix<double, 3, 3>  a( source.begin(), source.end() );
+    batched_matrix<double, 3, 1>  rhs( 37u );
+
+    for ( size_t  i = 0u ; i < 37u ; ++i )
+        for ( size_t  r = 0u ; r < 3u ; ++r )
+            rhs( i, r, 0 ) = double( r + i );
+
+    auto const  inv = inverse( a, 2u );
+    auto const  id = multiply( a, inv );
+    auto const  det = determinant( a );
+    auto const  x = lu_solve( a, rhs );
+    auto const  ax = multiply( a, x, 3u );
+
+    BOOST_CHECK_EQUAL( det.size(), 37u );
+    for ( size_t  i = 0u ; i < 37u ; ++i )
+    {
+        BOOST_CHECK_CLOSE( det[i], scalar_determinant(source[ i ]), 1e-9 );
+        for ( size_t  r = 0u ; r < 3u ; ++r )
+        {
+            BOOST_CHECK_SMALL( ax(i, r, 0) - rhs(i, r, 0), 1e-9 );
+            for ( size_t  c = 0u ; c < 3u ; ++c )
+                BOOST_CHECK_SMALL( id(i, r, c) - (r == c), 1e-9 );
+        }
+    }
+
+    // Swapping rows flips the sign of the determinant
+    auto  swapped = source[ 0 ];
+
+    std::swap( swapped[0], swapped[2] );
+    a.set( 0, swapped );
+    BOOST_CHECK_CLOSE( determinant(a)[0], -scalar_determinant(source[ 0 ]),
+     1e-9 );
+
+    // In place, into an existing batch
+    auto  b = a;
+
+    inverse( b, b );
+    inverse( b, b );
+    for ( size_t  r = 0u ; r < 3u ; ++r )
+        for ( size_t  c = 0u ; c < 3u ; ++c )
+            BOOST_CHECK_CLOSE( b(5, r, c), a(5, r, c), 1e-9 );
+
+    batched_matrix<double, 3, 1>  short_rhs( 36u );
+
+    BOOST_CHECK_THROW( lu_solve(a, short_rhs), std::invalid_argument );
+
+    // The unused lanes of a partial group never divide by zero
+    batched_matrix<double, 2, 2, 4>  d( 3u );
+
+    for ( size_t  i = 0u ; i < 3u ; ++i )
+    {
+        d( i, 0, 0 ) = double( i + 2u );
+        d( i, 0, 1 ) = d( i, 1, 0 ) = d( i, 1, 1 ) = 1.;
+    }
+
+    auto const  d_det = determinant( d );
+    auto const  d_inv = inverse( d );
+
+    for ( size_t  i = 0u ; i < 3u ; ++i )
+    {
+        BOOST_CHECK_CLOSE( d_det[i], double(i + 1u), 1e-9 );
+        BOOST_CHECK_CLOSE( d_inv(i, 1, 1), double(i + 2u) / double(i + 1u),
+         1e-9 );
+        BOOST_CHECK_CLOSE( d_inv(i, 0, 1), -1. / double(i + 1u), 1e-9 );
+    }
+
+    // The results keep zero padding
+    auto const  d_chol = cholesky( d );
+
+    for ( size_t  e = 0u ; e < 4u ; ++e )
+    {
+        BOOST_CHECK_EQUAL( d_inv.group_data(0)[e * 4u + 3u], 0. );
+        BOOST_CHECK_EQUAL( d_chol.group_data(0)[e * 4u + 3u], 0. );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_batched_cholesky )
+{
+    using boost::container::batched_matrix;
+    using std::size_t;
+
+    // Make symmetric positive-definite matrices as M * transpose(M)
+    std::vector<matrix3>  source, transposed;
+
+    for ( size_t  i = 0u ; i < 20u ; ++i )
+    {
+        source.push_back( sample(i) );
+        transposed.push_back( sample(i) );
+        for ( size_t  r = 0u ; r < 3u ; ++r )
+            for ( size_t  c = 0u ; c < 3u ; ++c )
+                transposed.back()[ r ][ c ] = source.back()[ c ][ r ];
+    }
+
+    batched_matrix<double, 3, 3>  m( source.begin(), source.end() ), mt(
+     transposed.begin(), transposed.end() );
+    auto const                    spd = multiply( m, mt );
+    auto const                    l = cholesky( spd );
+    batched_matrix<double, 3, 3>  lt( 20u );
+
+    for ( size_t  i = 0u ; i < 20u ; ++i )
+        for ( size_t  r = 0u ; r < 3u ; ++r )
+            for ( size_t  c = 0u ; c < 3u ; ++c )
+                lt( i, r, c ) = l( i, c, r );
+
+    auto const  back = multiply( l, lt );
+
+    for ( size_t  i = 0u ; i < 20u ; ++i )
+        for ( size_t  r = 0u ; r < 3u ; ++r )
+        {
+            BOOST_CHECK( l(i, r, r) > 0. );
+            for ( size_t  c = 0u ; c < 3u ; ++c )
+            {
+                BOOST_CHECK_SMALL( back(i, r, c) - spd(i, r, c), 1e-9 );
+                if ( c > r )
+                    BOOST_CHECK_EQUAL( l(i, r, c), 0. );
+            }
+        }
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_batched_matrix_basics
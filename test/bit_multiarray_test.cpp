@@ -0,0 +1,163 @@
+//  Boost Bit-Packed Multi-dimensional Array unit test program file  --------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/bit_multiarray.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+
+// Unit tests for packed flags  ----------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_bit_multiarray_basics )
+
+BOOST_AUTO_TEST_CASE( test_packed_bool_vector )
+{
+    using boost::container::packed_bool_vector;
+
+    // 130 flags use three words, the last one partially
+    packed_bool_vector  v( 130u, true );
+
+    BOOST_CHECK_EQUAL( v.size(), 130u );
+    BOOST_CHECK_EQUAL( v.word_count(), 3u );
+    BOOST_CHECK_EQUAL( v.count(), 130u );
+    BOOST_CHECK( v.all() );
+    BOOST_CHECK_EQUAL( v.word_data()[2], 3u );  // unused bits stay clear
+
+    v.flip();
+    BOOST_CHECK( !v.any() );
+    BOOST_CHECK_EQUAL( v.word_data()[2], 0u );
+
+    // Proxy access
+    *( v.begin() + 65 ) = true;
+    v.begin()[ 129 ] = v.cbegin()[ 65 ];
+    BOOST_CHECK_EQUAL( v.count(), 2u );
+    BOOST_CHECK_EQUAL( std::count(v.cbegin(), v.cend(), true), 2 );
+    BOOST_CHECK_EQUAL( std::find(v.cbegin(), v.cend(), true) - v.cbegin(), 65 );
+
+    packed_bool_vector  w( 130u );
+
+    w.begin()[ 65 ] = true;
+    w ^= v;
+    BOOST_CHECK_EQUAL( w.count(), 1u );
+    BOOST_CHECK( *(w.cbegin() + 129) );
+    BOOST_CHECK( w != v );
+    w |= v;
+    w &= v;
+    BOOST_CHECK( w == v );
+    BOOST_CHECK( packed_bool_vector().all() );
+}
+
+BOOST_AUTO_TEST_CASE( test_mask_access )
+{
+    using boost::container::bit_multiarray;
+    using std::size_t;
+
+    bit_multiarray<3>  mask( {{ 3u, 5u, 7u }}, false );
+    auto const &       cm = mask;
+
+    BOOST_CHECK_EQUAL( mask.size(), 105u );
+    BOOST_CHECK( mask.none() );
+
+    mask( 1, 2, 3 ) = true;
+    mask[ 2 ][ 4 ][ 6 ] = true;
+    mask.at( 0, 0, 0 ) = cm( 1, 2, 3 );
+    BOOST_CHECK_EQUAL( mask.count(), 3u );
+    BOOST_CHECK( cm(2, 4, 6) );
+    BOOST_CHECK( !cm[1][2][2] );
+    BOOST_CHECK_THROW( mask.at(3, 0, 0), std::out_of_range );
+
+    size_t  seen = 0u;
+
+    cm.capply( [&seen](bool b, size_t, size_t, size_t){ seen += b; } );
+    BOOST_CHECK_EQUAL( seen, 3u );
+
+    mask.fill( true );
+    BOOST_CHECK( mask.all() );
+    BOOST_CHECK_EQUAL( mask.count(), 105u );
+    mask.flip();
+    BOOST_CHECK( mask.none() );
+}
+
+BOOST_AUTO_TEST_CASE( test_mask_algebra )
+{
+    using boost::container::array_md;
+    using boost::container::bit_multiarray;
+
+    // Stripes and a checkerboard
+    bit_multiarray<2>  rows( {{ 10u, 20u }}, false ), board( {{ 10u, 20u }},
+     false );
+
+    for ( unsigned  i = 0u ; i < 10u ; ++i )
+        for ( unsigned  j = 0u ; j < 20u ; ++j )
+        {
+            rows( i, j ) = i % 2u == 0u;
+            board( i, j ) = ( i + j ) % 2u == 0u;
+        }
+
+    BOOST_CHECK_EQUAL( (rows & board).count(), 50u );
+    BOOST_CHECK_EQUAL( (rows | board).count(), 150u );
+    BOOST_CHECK_EQUAL( (rows ^ board).count(), 100u );
+    BOOST_CHECK_EQUAL( (~rows).count(), 100u );
+    BOOST_CHECK( (rows & ~rows).none() );
+    BOOST_CHECK( (rows | ~rows).all() );
+
+    bit_multiarray<2>  other( {{ 20u, 10u }}, false );
+
+    BOOST_CHECK_THROW( rows &= other, std::invalid_argument );
+
+    // Packing a built-in style array keeps the shape
+    array_md<bool, 2, 3>  flags{ {true, false, false, false, false, true} };
+    bit_multiarray<2>     packed( flags );
+
+    BOOST_CHECK( (packed.extents() == std::array<std::size_t, 2>{{ 2u, 3u }}) );
+    BOOST_CHECK( packed(0, 0) && packed(1, 2) );
+    BOOST_CHECK_EQUAL( packed.count(), 2u );
+}
+
+BOOST_AUTO_TEST_CASE( test_set_bits )
+{
+    using boost::container::bit_multiarray;
+
+    typedef bit_multiarray<2>::stats_type  index_type;
+
+    // Spread the flags over several words, with clear words in between
+    bit_multiarray<2>        mask( {{ 30u, 20u }}, false );
+    std::vector<index_type>  expected, found;
+
+    for ( std::size_t  i : {0u, 3u, 4u, 17u, 29u} )
+        for ( std::size_t  j : {0u, 19u} )
+        {
+            mask( i, j ) = true;
+            expected.push_back( index_type{{ i, j }} );
+        }
+    for ( auto const &x : mask.set_bits() )
+        found.push_back( x );
+    BOOST_CHECK( found == expected );
+
+    // Column-major order visits in memory order
+    mask.use_column_major_order();
+    found.clear();
+    for ( auto const &x : mask.set_bits() )
+        found.push_back( x );
+    BOOST_CHECK_EQUAL( found.size(), mask.count() );
+    for ( auto const &x : found )
+        BOOST_CHECK( mask(x[0], x[1]) );
+
+    // No flags, no iterations
+    mask.fill( false );
+    BOOST_CHECK( mask.set_bits().begin() == mask.set_bits().end() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_bit_multiarray_basics
@@ -0,0 +1,107 @@
+//  Boost Copy-on-Write Vector unit test program file  -----------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/cow_vector.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+
+// Unit tests for copy-on-write storage  -------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_cow_vector_basics )
+
+BOOST_AUTO_TEST_CASE( test_cow_sharing )
+{
+    using boost::container::cow_vector;
+
+    cow_vector<int>  empty_v;
+
+    BOOST_CHECK( empty_v.empty() && !empty_v.shared() );
+    BOOST_CHECK( empty_v.begin() == empty_v.end() );
+
+    cow_vector<int>         a{ 1, 2, 3 };
+    cow_vector<int>         b = a;
+    cow_vector<int> const  &cb = b;
+
+    BOOST_CHECK( a.shared() && b.shared() );
+    BOOST_CHECK_EQUAL( cb.data(), static_cast<cow_vector<int> const &>(a).data()
+     );
+
+    // Writing unshares, once
+    *b.begin() = 7;
+    BOOST_CHECK( !a.shared() && !b.shared() );
+    BOOST_CHECK_EQUAL( *cb.begin(), 7 );
+    BOOST_CHECK_EQUAL( *a.cbegin(), 1 );
+    BOOST_CHECK_EQUAL( cb.size(), 3u );
+}
+
+BOOST_AUTO_TEST_CASE( test_cow_multiarray )
+{
+    using boost::container::cow_multiarray;
+    using boost::container::cow_vector;
+    using std::size_t;
+
+    cow_multiarray<double, 2>  original( cow_vector<double>(std::vector<double>(
+     12u, 1.5)) );
+
+    original.extents( {{ 3u, 4u }} );
+
+    // Reading and reshaping don't copy
+    auto         copy = original;
+    auto const  &cc = copy;
+
+    BOOST_CHECK_EQUAL( cc(2, 3), 1.5 );
+    BOOST_CHECK_EQUAL( cc[1][2], 1.5 );
+    cc.capply( [](double, size_t, size_t){} );
+    copy.priorities( {{ 1u, 0u }} );
+    BOOST_CHECK_EQUAL( &cc(0, 0), &static_cast<decltype(original) const &>(
+     original)(0, 0) );
+
+    // Each kind of mutable access unshares
+    copy( 1, 1 ) = -1.;
+    BOOST_CHECK_EQUAL( original(1, 1), 1.5 );
+    BOOST_CHECK_EQUAL( copy(1, 1), -1. );
+
+    auto  c2 = original;
+
+    c2.at( 0, 0 ) = 2.;
+    BOOST_CHECK_EQUAL( original(0, 0), 1.5 );
+
+    // ...but only when the indexes are good
+    auto         c6 = original;
+    auto const  &cc6 = c6;
+
+    BOOST_CHECK_THROW( c6.at(3, 0), std::out_of_range );
+    BOOST_CHECK_THROW( c6.at({ 0u }), std::length_error );
+    BOOST_CHECK_EQUAL( &cc6(0, 0), &static_cast<decltype(original) const &>(
+     original)(0, 0) );
+
+    auto  c3 = original;
+
+    c3.fill( 0. );
+    BOOST_CHECK_EQUAL( original(2, 2), 1.5 );
+
+    auto  c4 = original;
+
+    c4.apply( [](double &x, size_t, size_t){ x *= 2.; } );
+    BOOST_CHECK_EQUAL( c4(2, 2), 3. );
+    BOOST_CHECK_EQUAL( original(2, 2), 1.5 );
+
+    auto  c5 = original;
+
+    c5[ 2 ][ 1 ] = 4.;
+    BOOST_CHECK_EQUAL( original(2, 1), 1.5 );
+    BOOST_CHECK_EQUAL( c5(2, 1), 4. );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_cow_vector_basics
@@ -0,0 +1,130 @@
+//  Boost Multi-dimensional Fenwick Tree unit test program file  ------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/fenwick_tree.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+
+// Unit tests for point updates and box sums  --------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_fenwick_tree_basics )
+
+BOOST_AUTO_TEST_CASE( test_fenwick_build )
+{
+    using boost::container::array_md;
+    using boost::container::fenwick_tree;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // Compare every box against brute force, with odd extents
+    multiarray<int, 3>  a( std::vector<int>(210u) );
+
+    a.extents( {{ 5u, 6u, 7u }} );
+    a.apply( [](int &x, size_t i, size_t j, size_t k){ x = int( i * 42u + j * 7u
+     + k ) % 11 - 5; } );
+
+    fenwick_tree<int, 3> const  t( a, 3u );
+    bool                        all_match = true;
+
+    BOOST_CHECK( t.extents() == a.extents() );
+    for ( size_t  i0 = 0u ; i0 <= 5u ; ++i0 )
+    for ( size_t  i1 = i0 ; i1 <= 5u ; ++i1 )
+    for ( size_t  j0 = 0u ; j0 <= 6u ; j0 += 2u )
+    for ( size_t  j1 = j0 ; j1 <= 6u ; ++j1 )
+    for ( size_t  k0 = 0u ; k0 <= 7u ; k0 += 3u )
+    for ( size_t  k1 = k0 ; k1 <= 7u ; ++k1 )
+    {
+        long  expected = 0;
+
+        for ( auto  i = i0 ; i < i1 ; ++i )
+            for ( auto  j = j0 ; j < j1 ; ++j )
+                for ( auto  k = k0 ; k < k1 ; ++k )
+                    expected += a( i, j, k );
+        all_match = all_match && t.sum( {{i0, j0, k0}}, {{i1, j1, k1}} ) ==
+         expected;
+    }
+    BOOST_CHECK( all_match );
+    BOOST_CHECK_EQUAL( t.value({{ 4u, 5u, 6u }}), a(4, 5, 6) );
+    BOOST_CHECK_THROW( t.sum({{ 0u, 0u, 0u }}, {{ 6u, 1u, 1u }}),
+     std::out_of_range );
+    BOOST_CHECK_THROW( t.sum({{ 2u, 0u, 0u }}, {{ 1u, 1u, 1u }}),
+     std::out_of_range );
+
+    // Built-in style sources, with one thread
+    array_md<double, 2, 3>            b{ {1.5, 2.0, 3.0, 4.0, 5.0, 6.5} };
+    fenwick_tree<double, 2> const     u( b, 1u );
+
+    BOOST_CHECK_CLOSE( u.prefix_sum({{ 2u, 3u }}), 22.0, 1e-9 );
+    BOOST_CHECK_CLOSE( u.sum({{ 1u, 1u }}, {{ 2u, 3u }}), 11.5, 1e-9 );
+
+    // Sources with a narrow index type
+    multiarray<double, 2, std::vector<double>, std::uint16_t>  n( std::vector<
+     double>(b.begin(), b.end()) );
+
+    n.extents( {{ 2u, 3u }} );
+    fenwick_tree<double, 2> const  v( n );
+
+    BOOST_CHECK_CLOSE( v.sum({{ 1u, 1u }}, {{ 2u, 3u }}), 11.5, 1e-9 );
+
+    // Sources whose containers are too small
+    n.extents( {{ 3u, 3u }} );
+    BOOST_CHECK_THROW( (fenwick_tree<double, 2>( n )), std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_fenwick_update )
+{
+    using boost::container::fenwick_tree;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // Mirror every update in a plain array
+    typedef fenwick_tree<int, 2>::stats_type  stats_type;
+
+    fenwick_tree<int, 2>  t( stats_type{{ 9u, 13u }} );
+    multiarray<int, 2>    mirror( std::vector<int>(117u) );
+
+    mirror.extents( t.extents() );
+
+    BOOST_CHECK_EQUAL( t.sum({{ 0u, 0u }}, {{ 9u, 13u }}), 0 );
+    for ( size_t  n = 0u ; n < 40u ; ++n )
+    {
+        size_t const  i = n * 5u % 9u, j = n * 7u % 13u;
+
+        t.add( {{i, j}}, int(n) - 20 );
+        mirror( i, j ) += int( n ) - 20;
+    }
+    t.set( {{ 8u, 12u }}, 100 );
+    mirror( 8, 12 ) = 100;
+    BOOST_CHECK_THROW( t.add({{ 9u, 0u }}, 1), std::out_of_range );
+
+    bool  all_match = true;
+
+    for ( size_t  i0 = 0u ; i0 <= 9u ; ++i0 )
+    for ( size_t  i1 = i0 ; i1 <= 9u ; ++i1 )
+    for ( size_t  j0 = 0u ; j0 <= 13u ; ++j0 )
+    for ( size_t  j1 = j0 ; j1 <= 13u ; ++j1 )
+    {
+        long  expected = 0;
+
+        for ( auto  i = i0 ; i < i1 ; ++i )
+            for ( auto  j = j0 ; j < j1 ; ++j )
+                expected += mirror( i, j );
+        all_match = all_match && t.sum( {{i0, j0}}, {{i1, j1}} ) == expected;
+    }
+    BOOST_CHECK( all_match );
+    BOOST_CHECK_EQUAL( t.value({{ 8u, 12u }}), 100 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_fenwick_tree_basics
@@ -0,0 +1,125 @@
+//  Boost Multi-dimensional Hybrid-Extent Array Adaptor unit test file  ------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/hybrid_multiarray.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+// Unit tests for basic functionality  ---------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_hybrid_multiarray_basics )
+
+BOOST_AUTO_TEST_CASE( test_hybrid_static_attributes )
+{
+    using boost::container::hybrid_multiarray;
+    using boost::container::multiarray_shape;
+    using boost::container::dynamic_extent;
+
+    typedef multiarray_shape<dynamic_extent, 3, 3>  shape_type;
+    typedef hybrid_multiarray<double, shape_type>   sample_type;
+
+    BOOST_REQUIRE_EQUAL( shape_type::rank, 3u );
+    BOOST_REQUIRE_EQUAL( shape_type::rank_dynamic, 1u );
+    BOOST_REQUIRE_EQUAL( sample_type::dimensionality, 3u );
+    BOOST_REQUIRE_EQUAL( sample_type::dynamic_rank, 1u );
+    BOOST_REQUIRE_EQUAL( sample_type::static_extent(0), dynamic_extent );
+    BOOST_REQUIRE_EQUAL( sample_type::static_extent(2), 3u );
+    BOOST_REQUIRE( (std::is_same<std::vector<double>,
+     sample_type::container_type>::value) );
+
+    typedef hybrid_multiarray<int, multiarray_shape<>>  scalar_type;
+
+    BOOST_REQUIRE_EQUAL( scalar_type::dimensionality, 0u );
+    BOOST_REQUIRE_EQUAL( scalar_type::dynamic_rank, 0u );
+}
+
+BOOST_AUTO_TEST_CASE( test_hybrid_indexing )
+{
+    using boost::container::hybrid_multiarray;
+    using boost::container::multiarray_shape;
+    using boost::container::dynamic_extent;
+    using std::size_t;
+
+    // The dynamic extent is sized from the container
+    hybrid_multiarray<int, multiarray_shape<dynamic_extent, 3, 2>>  sample(
+     std::vector<int>(18u) );
+    auto const &                                                    ss = sample;
+    std::array<size_t, 3> const  expected_extents{ {3u, 3u, 2u} };
+
+    BOOST_CHECK( ss.extents() == expected_extents );
+    BOOST_CHECK_EQUAL( ss.extent(0), 3u );
+    BOOST_CHECK_EQUAL( ss.required_size(), 18u );
+    BOOST_CHECK_EQUAL( ss.size(), 18u );
+
+    sample.apply( [](int &x, size_t i, size_t j, size_t k){
+        x = static_cast<int>( 100 * i + 10 * j + k );
+    } );
+    BOOST_CHECK_EQUAL( ss(2, 1, 1), 211 );
+    BOOST_CHECK_EQUAL( ss({ 1, 2, 0 }), 120 );
+    BOOST_CHECK_EQUAL( (ss[{ 0, 0, 1 }]), 1 );
+    BOOST_CHECK_EQUAL( ss.at(1, 1, 1), 111 );
+    BOOST_CHECK( &sample(1, 0, 0) - &sample(0, 0, 0) == 6 );
+    sample( 0, 1, 0 ) = -5;
+    BOOST_CHECK_EQUAL( ss.at({ 0, 1, 0 }), -5 );
+    BOOST_CHECK_THROW( ss.at(3, 0, 0), std::out_of_range );
+    BOOST_CHECK_THROW( ss.at(0, 0, 2), std::out_of_range );
+    BOOST_CHECK_THROW( ss.at({ 0, 0 }), std::length_error );
+
+    // Only the dynamic extent may change
+    BOOST_CHECK_THROW( sample.extents(2u, 2u, 2u), std::invalid_argument );
+    BOOST_CHECK_THROW( sample.extents(0u, 3u, 2u), std::out_of_range );
+    sample.extents( 2u, 3u, 2u );
+    BOOST_CHECK_EQUAL( ss.required_size(), 12u );
+    BOOST_CHECK_EQUAL( ss(1, 2, 1), 121 );
+
+    // Under-sized containers stop early
+    sample.extents( 4u, 3u, 2u );
+    sample.fill( 7 );
+    size_t  visited = 0u;
+
+    ss.capply( [&visited](int x, size_t, size_t, size_t){
+        visited += ( x == 7 );
+    } );
+    BOOST_CHECK_EQUAL( visited, 18u );
+}
+
+BOOST_AUTO_TEST_CASE( test_hybrid_inner_dynamic )
+{
+    using boost::container::hybrid_multiarray;
+    using boost::container::multiarray_shape;
+    using boost::container::dynamic_extent;
+    using std::size_t;
+
+    hybrid_multiarray<int, multiarray_shape<2, dynamic_extent, dynamic_extent>,
+     std::array<int, 24>>  sample, other;
+
+    BOOST_CHECK_EQUAL( sample.extent(1), 12u );
+    BOOST_CHECK_EQUAL( sample.extent(2), 1u );
+    sample.extents( 2u, 3u, 4u );
+    sample.apply( [](int &x, size_t i, size_t j, size_t k){
+        x = static_cast<int>( 100 * i + 10 * j + k );
+    } );
+    BOOST_CHECK_EQUAL( sample(1, 2, 3), 123 );
+    BOOST_CHECK( &sample(1, 0, 0) - &sample(0, 0, 0) == 12 );
+
+    using std::swap;
+    swap( sample, other );
+    BOOST_CHECK_EQUAL( other.extent(2), 4u );
+    BOOST_CHECK_EQUAL( other(1, 1, 1), 111 );
+    BOOST_CHECK_EQUAL( sample.extent(2), 1u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_hybrid_multiarray_basics
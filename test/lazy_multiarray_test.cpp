@@ -0,0 +1,187 @@
+//  Boost Lazy Multi-dimensional Array unit test program file  --------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/lazy_multiarray.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// Unit tests for lazy computation  ------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_lazy_multiarray_basics )
+
+BOOST_AUTO_TEST_CASE( test_lazy_access )
+{
+    using boost::container::make_lazy_multiarray;
+    using std::size_t;
+
+    // 10-by-10 table, all in one default-sized block; count the generator
+    // calls
+    std::atomic<int>  calls( 0 );
+    auto              table = make_lazy_multiarray<2>( {{ 10u, 10u }},
+     [&calls](size_t i, size_t j){ ++calls; return 10.0 * i + j; } );
+
+    BOOST_REQUIRE( (std::is_same<decltype(table)::value_type, double>::value)
+     );
+    BOOST_CHECK_EQUAL( table.size(), 100u );
+    BOOST_CHECK_EQUAL( table.block_count(), 1u );
+    BOOST_CHECK_EQUAL( table.materialized_count(), 0u );
+    BOOST_CHECK_EQUAL( calls.load(), 0 );
+
+    // One read computes one block
+    BOOST_CHECK_EQUAL( table(3, 4), 34.0 );
+    BOOST_CHECK_EQUAL( table.at(9, 9), 99.0 );
+    BOOST_CHECK_EQUAL( calls.load(), 100 );
+    BOOST_CHECK_THROW( table.at(10, 0), std::out_of_range );
+    BOOST_CHECK_THROW( make_lazy_multiarray<2>({{ 0u, 3u }}, [](size_t,
+     size_t){ return 0; }), std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE( test_lazy_blocks )
+{
+    using boost::container::lazy_multiarray;
+    using std::size_t;
+
+    struct generator
+    {
+        std::atomic<int> *  calls;
+
+        long  operator ()( size_t i, size_t j, size_t k ) const
+        { ++*calls; return static_cast<long>( 100u * i + 10u * j + k ); }
+    };
+
+    std::atomic<int>                              calls( 0 );
+    lazy_multiarray<long, 3, generator, 16>  table( {{ 4u, 5u, 6u }},
+     generator{&calls} );
+
+    BOOST_CHECK_EQUAL( table.block_count(), 8u );
+
+    // Only the touched blocks are computed, in whole
+    BOOST_CHECK_EQUAL( table(0, 2, 3), 23L );       // offset 15, block 0
+    BOOST_CHECK_EQUAL( table(3, 4, 5), 345L );      // offset 119, block 7
+    BOOST_CHECK_EQUAL( calls.load(), 16 + 8 );
+    BOOST_CHECK( table.is_materialized(0u) && table.is_materialized(7u) );
+    BOOST_CHECK( !table.is_materialized(1u) );
+    BOOST_CHECK_EQUAL( table(0, 2, 2), 22L );
+    BOOST_CHECK_EQUAL( calls.load(), 24 );
+
+    // Precomputing fills in the rest, once each
+    table.materialize_all( 3u );
+    BOOST_CHECK_EQUAL( table.materialized_count(), 8u );
+    BOOST_CHECK_EQUAL( calls.load(), 120 );
+    BOOST_CHECK_EQUAL( table(2, 1, 0), 210L );
+    BOOST_CHECK_EQUAL( calls.load(), 120 );
+}
+
+BOOST_AUTO_TEST_CASE( test_lazy_construction )
+{
+    using boost::container::lazy_multiarray;
+    using std::size_t;
+
+    // Elements without a default constructor, counting their lifetimes
+    static int  live = 0;
+
+    struct counted
+    {
+        explicit  counted( size_t v ) : value( v )  { ++live; }
+                  counted( counted const &c ) : value( c.value )  { ++live; }
+                  ~counted()  { --live; }
+
+        size_t  value;
+    };
+
+    struct generator
+    {
+        size_t  operator ()( size_t i, size_t j ) const
+        {
+            if ( i == 2u && j == 5u )
+                throw std::runtime_error{ "bad element" };
+            return i * 8u + j;
+        }
+    };
+
+    {
+        lazy_multiarray<counted, 2, generator, 8>  table( {{ 4u, 8u }},
+         generator{} );
+
+        // Setting up constructs nothing
+        BOOST_CHECK_EQUAL( live, 0 );
+        BOOST_CHECK_EQUAL( table(1, 3).value, 11u );
+        BOOST_CHECK_EQUAL( live, 8 );
+
+        // A failed block destroys what it built
+        BOOST_CHECK_THROW( table(2, 0), std::runtime_error );
+        BOOST_CHECK_EQUAL( live, 8 );
+        BOOST_CHECK_EQUAL( table(3, 7).value, 31u );
+        BOOST_CHECK_EQUAL( live, 16 );
+
+        // Moving hands over the blocks
+        auto const  moved = std::move( table );
+
+        BOOST_CHECK_EQUAL( moved(1, 0).value, 8u );
+        BOOST_CHECK_EQUAL( live, 16 );
+    }
+
+    // Only the computed elements are destroyed, once each
+    BOOST_CHECK_EQUAL( live, 0 );
+}
+
+BOOST_AUTO_TEST_CASE( test_lazy_concurrency )
+{
+    using boost::container::lazy_multiarray;
+    using std::size_t;
+
+    struct generator
+    {
+        std::atomic<int> *  calls;
+        std::atomic<int> *  failures;
+
+        size_t  operator ()( size_t i, size_t j ) const
+        {
+            ++*calls;
+            if ( i == 3u && j == 0u && failures->fetch_sub(1) > 0 )
+                throw std::runtime_error{ "flaky" };
+            return i * 1000u + j;
+        }
+    };
+
+    std::atomic<int>                             calls( 0 ), failures( 1 );
+    lazy_multiarray<size_t, 2, generator, 64>  table( {{ 50u, 1000u }},
+     generator{&calls, &failures} );
+
+    // A throwing generator leaves the block for the next reader
+    BOOST_CHECK_THROW( table(3, 5), std::runtime_error );
+    BOOST_CHECK( !table.is_materialized(3000u / 64u) );
+    BOOST_CHECK_EQUAL( table(3, 5), 3005u );
+
+    // Readers racing over the same blocks compute each element once
+    int const                 before = calls.load();
+    std::atomic<int>          wrong( 0 );
+    std::vector<std::thread>  readers;
+
+    for ( int  t = 0 ; t < 4 ; ++t )
+        readers.emplace_back( [&table, &wrong](){
+            for ( size_t  i = 0u ; i < 50u ; ++i )
+                for ( size_t  j = 0u ; j < 1000u ; j += 7u )
+                    wrong += table( i, j ) != i * 1000u + j;
+        } );
+    for ( auto &t : readers )
+        t.join();
+    BOOST_CHECK_EQUAL( wrong.load(), 0 );
+    BOOST_CHECK_EQUAL( calls.load() - before, 50000 - 64 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_lazy_multiarray_basics
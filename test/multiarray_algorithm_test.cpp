@@ -0,0 +1,436 @@
+//  Boost Multi-dimensional Array Algorithms unit test program file  --------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray_algorithm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// Unit tests for fiber sorting  ---------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_sorting )
+
+BOOST_AUTO_TEST_CASE( test_sort_along )
+{
+    using boost::container::multiarray;
+    using boost::container::sort_along;
+    using std::size_t;
+
+    // Scrambled values, the same for each layout
+    std::vector<int>  values( 60u );
+
+    for ( size_t  i = 0u ; i < values.size() ; ++i )
+        values[ i ] = static_cast<int>( (i * 37u) % 61u );
+
+    for ( size_t  axis = 0u ; axis < 3u ; ++axis )
+    {
+        multiarray<int, 3>  rm( values ), cm( values );
+
+        rm.extents( {{ 3u, 4u, 5u }} );
+        cm.extents_and_priorities( {{ 3u, 4u, 5u }}, {{ 2u, 1u, 0u }} );
+        sort_along( rm, axis, std::less<int>{}, 3u );
+        sort_along( cm, axis, std::greater<int>{} );
+
+        rm.capply( [&rm, axis](int x, size_t i, size_t j, size_t k){
+            size_t  p[] = { i, j, k };
+
+            if ( p[axis]-- )
+                BOOST_CHECK_LE( rm(p[ 0 ], p[ 1 ], p[ 2 ]), x );
+        } );
+        cm.capply( [&cm, axis](int x, size_t i, size_t j, size_t k){
+            size_t  p[] = { i, j, k };
+
+            if ( p[axis]-- )
+                BOOST_CHECK_GE( cm(p[ 0 ], p[ 1 ], p[ 2 ]), x );
+        } );
+
+        // No values were lost
+        std::vector<int>  sorted( rm.begin(), rm.end() ), original = values;
+
+        std::sort( sorted.begin(), sorted.end() );
+        std::sort( original.begin(), original.end() );
+        BOOST_CHECK( sorted == original );
+    }
+
+    multiarray<int, 2>  bad( values );
+
+    BOOST_CHECK_THROW( sort_along(bad, 2u), std::out_of_range );
+    bad.extents( {{ 8u, 8u }} );  // more than the 60 elements held
+    BOOST_CHECK_THROW( sort_along(bad, 1u), std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_nth_element_along )
+{
+    using boost::container::multiarray;
+    using boost::container::nth_element_along;
+    using std::size_t;
+
+    multiarray<double, 2>  sample( std::vector<double>{ 5., 1., 4., 9., 2., 8.,
+     7., 3., 6., 0., 11., 10. } );
+
+    sample.extents( {{ 3u, 4u }} );
+    nth_element_along( sample, 0u, 1u );  // medians of columns
+    for ( size_t  j = 0u ; j < 4u ; ++j )
+    {
+        BOOST_CHECK_LE( sample(0, j), sample(1, j) );
+        BOOST_CHECK_LE( sample(1, j), sample(2, j) );
+    }
+    BOOST_CHECK_EQUAL( sample(1, 0), 5. );
+    BOOST_CHECK_EQUAL( sample(1, 3), 9. );
+
+    nth_element_along( sample, 1u, 0u, std::less<double>{}, 2u );  // row mins
+    BOOST_CHECK_EQUAL( sample(0, 0), 0. );
+    BOOST_CHECK_EQUAL( sample(1, 0), 1. );
+    BOOST_CHECK_EQUAL( sample(2, 0), 6. );
+    BOOST_CHECK_THROW( nth_element_along(sample, 1u, 4u), std::out_of_range );
+    sample.extents( {{ 4u, 4u }} );
+    BOOST_CHECK_THROW( nth_element_along(sample, 1u, 0u), std::length_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_sorting
+
+
+// Unit tests for fiber scanning  --------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_scanning )
+
+BOOST_AUTO_TEST_CASE( test_inclusive_scan_along )
+{
+    using boost::container::exclusive_scan_along;
+    using boost::container::inclusive_scan_along;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    std::vector<long>  values( 60u );
+
+    for ( size_t  i = 0u ; i < values.size() ; ++i )
+        values[ i ] = static_cast<long>( (i * 37u) % 61u );
+
+    for ( size_t  axis = 0u ; axis < 3u ; ++axis )
+        for ( unsigned  threads = 1u ; threads < 5u ; threads += 3u )
+        {
+            multiarray<long, 3>  sample( values ), original( values );
+
+            sample.extents_and_priorities( {{ 3u, 4u, 5u }}, {{ 1u, 2u, 0u }} );
+            original.extents_and_priorities( {{ 3u, 4u, 5u }}, {{ 1u, 2u, 0u }}
+             );
+            inclusive_scan_along( sample, axis, std::plus<long>{}, threads );
+
+            original.capply( [&](long, size_t i, size_t j, size_t k){
+                size_t  p[] = { i, j, k };
+                long    sum = 0;
+
+                for ( size_t  q = 0u, last = p[axis] ; q <= last ; ++q )
+                {
+                    p[ axis ] = q;
+                    sum += original( p[0], p[1], p[2] );
+                }
+                BOOST_CHECK_EQUAL( sample(i, j, k), sum );
+            } );
+        }
+
+    multiarray<long, 1>  bad( values );
+
+    BOOST_CHECK_THROW( inclusive_scan_along(bad, 1u), std::out_of_range );
+    bad.extents( {{ 61u }} );
+    BOOST_CHECK_THROW( inclusive_scan_along(bad, 0u), std::length_error );
+    BOOST_CHECK_THROW( exclusive_scan_along(bad, 0u, 0l), std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_scan_along_contiguous_fibers )
+{
+    using boost::container::exclusive_scan_along;
+    using boost::container::inclusive_scan_along;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // More fibers than a batch, and longer than a buffered tile
+    std::vector<long>  values( 37u * 300u );
+
+    for ( size_t  i = 0u ; i < values.size() ; ++i )
+        values[ i ] = static_cast<long>( (i * 37u) % 61u ) - 30;
+
+    for ( unsigned  threads = 1u ; threads < 5u ; threads += 2u )
+    {
+        multiarray<long, 2>  in( values ), ex( values );
+        bool                 all_match = true;
+
+        in.extents( {{ 37u, 300u }} );
+        ex.extents( {{ 37u, 300u }} );
+        inclusive_scan_along( in, 1u, std::plus<long>{}, threads );
+        exclusive_scan_along( ex, 1u, 5l, std::plus<long>{}, threads );
+        for ( size_t  i = 0u ; i < 37u ; ++i )
+        {
+            long  sum = 0;
+
+            for ( size_t  j = 0u ; j < 300u ; ++j )
+            {
+                all_match = all_match && ex( i, j ) == sum + 5;
+                sum += values[ i * 300u + j ];
+                all_match = all_match && in( i, j ) == sum;
+            }
+        }
+        BOOST_CHECK( all_match );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_exclusive_scan_along )
+{
+    using boost::container::array_md;
+    using boost::container::exclusive_scan_along;
+    using boost::container::inclusive_scan_along;
+
+    array_md<int, 2, 3>  sample{ {{ 1, 2, 3 }, { 4, 5, 6 }} };
+
+    exclusive_scan_along( sample, 1u, 10 );
+    BOOST_CHECK_EQUAL( sample[0][0], 10 );
+    BOOST_CHECK_EQUAL( sample[0][1], 11 );
+    BOOST_CHECK_EQUAL( sample[0][2], 13 );
+    BOOST_CHECK_EQUAL( sample[1][2], 19 );
+
+    exclusive_scan_along( sample, 0u, 1, std::multiplies<int>{}, 2u );
+    BOOST_CHECK_EQUAL( sample[0][1], 1 );
+    BOOST_CHECK_EQUAL( sample[1][0], 10 );
+    BOOST_CHECK_EQUAL( sample[1][2], 13 );
+
+    inclusive_scan_along( sample, 0u );
+    BOOST_CHECK_EQUAL( sample[1][1], 12 );
+}
+
+BOOST_AUTO_TEST_CASE( test_rolling_along )
+{
+    using boost::container::multiarray;
+    using boost::container::rolling_along;
+    using boost::container::rolling_op;
+    using std::size_t;
+
+    std::vector<long>  values( 105u );
+
+    for ( size_t  i = 0u ; i < values.size() ; ++i )
+        values[ i ] = static_cast<long>( (i * 37u) % 61u ) - 30;
+
+    rolling_op const  ops[] = { rolling_op::sum, rolling_op::mean,
+     rolling_op::min, rolling_op::max };
+
+    // Compare against brute force, including windows longer than the fibers
+    for ( size_t  axis = 0u ; axis < 3u ; ++axis )
+        for ( size_t  window : {1u, 2u, 3u, 8u} )
+            for ( auto const  op : ops )
+            {
+                multiarray<long, 3>  sample( values );
+
+                sample.extents_and_priorities( {{ 3u, 5u, 7u }}, {{ 1u, 2u,
+                 0u }} );
+
+                auto const  result = rolling_along( sample, axis, window, op,
+                 1u + window % 3u );
+                bool        all_match = true;
+
+                BOOST_CHECK( result.priorities() == sample.priorities() );
+                sample.capply( [&](long, size_t i, size_t j, size_t k){
+                    size_t  p[] = { i, j, k };
+                    auto    first = p[ axis ] + 1u > window ? p[ axis ] + 1u -
+                     window : 0u, last = p[ axis ];
+                    long    sum = 0, least = 1000, greatest = -1000;
+
+                    for ( auto  q = first ; q <= last ; ++q )
+                    {
+                        p[ axis ] = q;
+
+                        long const  x = sample( p[0], p[1], p[2] );
+
+                        sum += x;
+                        least = std::min( least, x );
+                        greatest = std::max( greatest, x );
+                    }
+
+                    long const  expected[] = { sum, sum / long(last + 1u -
+                     first), least, greatest };
+
+                    all_match = all_match && result( i, j, k ) == expected[
+                     static_cast<int>(op) ];
+                } );
+                BOOST_CHECK( all_match );
+            }
+
+    multiarray<long, 1>  bad( values );
+
+    BOOST_CHECK_THROW( rolling_along(bad, 1u, 2u, rolling_op::sum),
+     std::out_of_range );
+    BOOST_CHECK_THROW( rolling_along(bad, 0u, 0u, rolling_op::sum),
+     std::invalid_argument );
+    bad.extents( {{ 106u }} );
+    BOOST_CHECK_THROW( rolling_along(bad, 0u, 2u, rolling_op::max),
+     std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_rolling_along_array_md )
+{
+    using boost::container::array_md;
+    using boost::container::rolling_along;
+    using boost::container::rolling_op;
+
+    array_md<double, 2, 4> const  sample{ {{ 1., 2., 3., 4. }, { 8., 6., 7.,
+     5. }} };
+    auto const                    mean = rolling_along( sample, 1u, 2u,
+     rolling_op::mean );
+    auto const                    top = rolling_along( sample, 1u, 3u,
+     rolling_op::max, 2u );
+
+    BOOST_CHECK_CLOSE( mean[0][0], 1.0, 1e-9 );
+    BOOST_CHECK_CLOSE( mean[0][3], 3.5, 1e-9 );
+    BOOST_CHECK_CLOSE( mean[1][2], 6.5, 1e-9 );
+    BOOST_CHECK_EQUAL( top[1][1], 8. );
+    BOOST_CHECK_EQUAL( top[1][3], 7. );
+    BOOST_CHECK_EQUAL( top[0][2], 3. );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_scanning
+
+
+// Unit tests for tiling  ----------------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_tiling )
+
+BOOST_AUTO_TEST_CASE( test_for_each_tile )
+{
+    using boost::container::for_each_tile;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // Column-major 5-by-7, so tiles go down columns first
+    multiarray<int, 2>  sample( std::vector<int>(35u) );
+    auto const &        ss = sample;
+    std::vector<std::array<size_t, 2>>  origins;
+
+    sample.extents_and_priorities( {{ 5u, 7u }}, {{ 1u, 0u }} );
+    for_each_tile( ss, {{ 2u, 3u }}, [&origins](boost::container::
+     multiarray_tile<std::vector<int>::const_iterator, size_t, 2> const &t){
+        origins.push_back( t.origin() );
+    }, 1u );
+    BOOST_REQUIRE_EQUAL( origins.size(), 9u );
+    BOOST_CHECK( (origins[ 1 ] == std::array<size_t, 2>{{ 2u, 0u }}) );
+    BOOST_CHECK( (origins[ 3 ] == std::array<size_t, 2>{{ 0u, 3u }}) );
+    BOOST_CHECK( (origins[ 8 ] == std::array<size_t, 2>{{ 4u, 6u }}) );
+
+    // Every element is visited once, with edge tiles cut short
+    typedef boost::container::multiarray_tile<std::vector<int>::iterator,
+     size_t, 2>  tile_type;
+
+    for_each_tile( sample, {{ 2u, 3u }}, [](tile_type const &t){
+        auto const  o = t.origin();
+
+        BOOST_CHECK_LE( t.extents()[0], 2u );
+        BOOST_CHECK_LE( t.extents()[1], 3u );
+        t.apply( [&o](int &x, size_t i, size_t j){
+            x += static_cast<int>( 10 * (o[0] + i) + o[1] + j + 1u );
+        } );
+    }, 3u );
+    ss.capply( [](int x, size_t i, size_t j){
+        BOOST_CHECK_EQUAL( x, static_cast<int>(10 * i + j + 1u) );
+    } );
+
+    // Relative element access
+    for_each_tile( sample, {{ 4u, 4u }}, [](tile_type const &t){
+        if ( t.origin()[0] && t.origin()[1] )
+        {
+            BOOST_CHECK_EQUAL( t.size(), 3u );
+            BOOST_CHECK_EQUAL( t(0, 2), 47 );
+        }
+    } );
+    BOOST_CHECK_THROW( for_each_tile(sample, {{ 0u, 1u }}, [](tile_type const
+     &){}), std::out_of_range );
+    sample.extents( {{ 6u, 7u }} );
+    BOOST_CHECK_THROW( for_each_tile(sample, {{ 2u, 2u }}, [](tile_type const
+     &){}), std::length_error );
+
+    // Large arrays still stay on the calling thread by default
+    multiarray<int, 2>  big( std::vector<int>(1u << 16) );
+    auto const          caller = std::this_thread::get_id();
+    size_t              elsewhere = 0u;
+
+    big.extents( {{ 256u, 256u }} );
+    for_each_tile( big, {{ 16u, 16u }}, [caller, &elsewhere](tile_type const
+     &){ elsewhere += std::this_thread::get_id() != caller; } );
+    BOOST_CHECK_EQUAL( elsewhere, 0u );
+}
+
+BOOST_AUTO_TEST_CASE( test_for_each_tile_array_md )
+{
+    using boost::container::array_md;
+    using boost::container::for_each_tile;
+    using std::size_t;
+
+    array_md<double, 3, 4, 5> const  sample{};
+    double                          total = 0.;
+    size_t                          count = 0u;
+
+    for_each_tile( sample, {{ 2u, 2u, 5u }}, [&](boost::container::
+     multiarray_tile<double const *, size_t, 3> const &t){
+        total += static_cast<double>( t.size() );
+        ++count;
+    } );
+    BOOST_CHECK_EQUAL( count, 4u );
+    BOOST_CHECK_EQUAL( total, 60. );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_tiling
+
+
+// Unit tests for arrays with a narrow index type  ---------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_narrow_index )
+
+BOOST_AUTO_TEST_CASE( test_narrow_index_algorithms )
+{
+    using boost::container::multiarray;
+    using std::uint32_t;
+
+    typedef multiarray<int, 2, std::vector<int>, uint32_t>  sample_type;
+
+    sample_type  sample( std::vector<int>{ 3, 1, 2, 6, 5, 4 } );
+
+    sample.extents( {{ 2u, 3u }} );
+    boost::container::sort_along( sample, 1u );
+    BOOST_CHECK( (std::vector<int>( sample.begin(), sample.end() ) ==
+     std::vector<int>{ 1, 2, 3, 4, 5, 6 }) );
+    boost::container::nth_element_along( sample, 0u, 0u, std::greater<int>{} );
+    BOOST_CHECK_EQUAL( sample(0, 0), 4 );
+    boost::container::inclusive_scan_along( sample, 0u );
+    BOOST_CHECK_EQUAL( sample(1, 2), 9 );
+    boost::container::exclusive_scan_along( sample, 1u, 0 );
+    BOOST_CHECK_EQUAL( sample(1, 2), 12 );
+
+    int  total = 0;
+
+    boost::container::for_each_tile( sample, {{ 1u, 2u }}, [&total](boost::
+     container::multiarray_tile<std::vector<int>::iterator, uint32_t, 2> const
+     &t){
+        t.apply( [&total](int x, uint32_t, uint32_t){ total += x; } );
+    } );
+    BOOST_CHECK_EQUAL( total, 0 + 4 + 9 + 0 + 5 + 12 );
+
+    auto const  maxes = boost::container::rolling_along( sample, 0u, 2u,
+     boost::container::rolling_op::max );
+
+    BOOST_CHECK( (std::is_same<decltype( maxes ), sample_type const>::value) );
+    BOOST_CHECK_EQUAL( maxes(1, 2), 12 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_narrow_index
@@ -0,0 +1,135 @@
+//  Boost Multi-dimensional Array Contraction unit test program file  -------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray_contraction.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+
+// Unit tests for tensor contraction  ----------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_contraction_basics )
+
+BOOST_AUTO_TEST_CASE( test_matrix_products )
+{
+    using boost::container::contract;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // Large enough for the blocked kernel, with ragged blocks
+    multiarray<long, 2>  a( std::vector<long>(70u * 300u) ), b( std::vector<
+     long>(300u * 40u) );
+
+    a.extents( {{ 70u, 300u }} );
+    b.extents_and_priorities( {{ 300u, 40u }}, {{ 1u, 0u }} );
+    a.apply( [](long &x, size_t i, size_t j){ x = long( (i * 7u + j * 3u) % 13u
+     ) - 6; } );
+    b.apply( [](long &x, size_t i, size_t j){ x = long( (i * 5u + j * 11u) %
+     17u ) - 8; } );
+
+    for ( unsigned  threads = 1u ; threads < 5u ; threads += 3u )
+    {
+        auto const  c = contract( a, "ij", b, "jk", "ik", threads );
+        auto const  ct = contract( a, "ij", b, "jk", "ki", threads );
+        bool        all_match = true;
+
+        BOOST_CHECK( (c.extents() == std::array<size_t, 2>{{ 70u, 40u }}) );
+        BOOST_CHECK( (ct.extents() == std::array<size_t, 2>{{ 40u, 70u }}) );
+        for ( size_t  i = 0u ; i < 70u ; ++i )
+            for ( size_t  k = 0u ; k < 40u ; ++k )
+            {
+                long  sum = 0;
+
+                for ( size_t  j = 0u ; j < 300u ; ++j )
+                    sum += a( i, j ) * b( j, k );
+                all_match = all_match && c( i, k ) == sum && ct( k, i ) == sum;
+            }
+        BOOST_CHECK( all_match );
+    }
+
+    // Outer product and full contraction
+    multiarray<int, 1>  u( std::vector<int>{1, 2, 3} ), v( std::vector<int>{4,
+     5} );
+    auto const          outer = contract( u, "i", v, "j", "ij" );
+
+    BOOST_CHECK_EQUAL( outer(2, 1), 15 );
+    BOOST_CHECK_EQUAL( outer(0, 0), 4 );
+    BOOST_CHECK_EQUAL( contract(u, "i", u, "i", "")(), 14 );
+
+    // Operands with a narrow index type
+    multiarray<int, 1, std::vector<int>, std::uint16_t>  w( std::vector<int>{
+     1, 2, 3} );
+
+    BOOST_CHECK_EQUAL( contract(w, "i", u, "i", "")(), 14 );
+    BOOST_CHECK_EQUAL( contract(v, "j", w, "i", "ij")(2, 1), 15 );
+}
+
+BOOST_AUTO_TEST_CASE( test_general_contractions )
+{
+    using boost::container::contract;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // Batched product, with the batch axis in different places
+    multiarray<double, 3>  a( std::vector<double>(4u * 30u * 50u) ), b(
+     std::vector<double>(50u * 4u * 20u) );
+
+    a.extents( {{ 4u, 30u, 50u }} );
+    b.extents( {{ 50u, 4u, 20u }} );
+    a.apply( [](double &x, size_t h, size_t i, size_t j){ x = double( (h + i *
+     3u + j * 7u) % 10u ); } );
+    b.apply( [](double &x, size_t j, size_t h, size_t k){ x = double( (j * 2u +
+     h * 5u + k) % 9u ) - 4.; } );
+
+    auto const  c = contract( a, "bij", b, "jbk", "bik", 2u );
+    bool        all_match = true;
+
+    for ( size_t  h = 0u ; h < 4u ; ++h )
+        for ( size_t  i = 0u ; i < 30u ; ++i )
+            for ( size_t  k = 0u ; k < 20u ; ++k )
+            {
+                double  sum = 0.;
+
+                for ( size_t  j = 0u ; j < 50u ; ++j )
+                    sum += a( h, i, j ) * b( j, h, k );
+                all_match = all_match && c( h, i, k ) == sum;
+            }
+    BOOST_CHECK( all_match );
+
+    // Diagonals, and summing an axis found in one operand only
+    multiarray<int, 2>  m( std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9} );
+    multiarray<int, 1>  w( std::vector<int>{1, 10, 100} );
+
+    m.extents( {{ 3u, 3u }} );
+    BOOST_CHECK_EQUAL( contract(m, "ii", w, "i", "")(), 1 + 50 + 900 );
+    BOOST_CHECK_EQUAL( contract(m, "ij", w, "k", "k")(1), 450 );
+    BOOST_CHECK_EQUAL( contract(m, "ij", w, "j", "i")(2), 987 );
+    BOOST_CHECK_EQUAL( contract(m, "ij", w, "x", "ij")(1, 2), 666 );
+
+    // Bad labels
+    multiarray<int, 2>  r( std::vector<int>(6u) );
+
+    r.extents( {{ 2u, 3u }} );
+    BOOST_CHECK_THROW( contract(r, "ij", w, "i", "j"), std::invalid_argument );
+    BOOST_CHECK_THROW( contract(m, "i", w, "i", "i"), std::invalid_argument );
+    BOOST_CHECK_THROW( contract(m, "ij", w, "j", "q"), std::invalid_argument );
+    BOOST_CHECK_THROW( contract(m, "ij", w, "j", "ii"), std::invalid_argument );
+
+    // Containers short of the extents
+    r.extents( {{ 3u, 3u }} );
+    BOOST_CHECK_THROW( contract(r, "ij", w, "j", "i"), std::length_error );
+    BOOST_CHECK_THROW( contract(w, "j", r, "ij", "i"), std::length_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_contraction_basics
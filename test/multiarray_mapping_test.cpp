@@ -0,0 +1,134 @@
+//  Boost Multi-dimensional Array Layout-Mapping unit test program file  ----//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray_mapping.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+// Unit tests for layout mappings  -------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_mapping_basics )
+
+BOOST_AUTO_TEST_CASE( test_mapping_from_arrays )
+{
+    using boost::container::make_layout_mapping;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // Column-major multiarray
+    std::vector<int>    buffer( 24u );
+    multiarray<int, 3>  sample;
+
+    std::iota( buffer.begin(), buffer.end(), 0 );
+    sample = multiarray<int, 3>( buffer );
+    sample.extents_and_priorities( {{ 2u, 3u, 4u }}, {{ 2u, 1u, 0u }} );
+
+    auto const  m = make_layout_mapping( sample );
+
+    BOOST_CHECK_EQUAL( m.extents().rank(), 3u );
+    BOOST_CHECK_EQUAL( m.extents().extent(1), 3u );
+    BOOST_CHECK_EQUAL( m.stride(0), 1u );
+    BOOST_CHECK_EQUAL( m.stride(1), 2u );
+    BOOST_CHECK_EQUAL( m.stride(2), 6u );
+    BOOST_CHECK_EQUAL( m.required_span_size(), 24u );
+    BOOST_CHECK( m.is_exhaustive() );
+    BOOST_CHECK( m.is_strided() && m.is_unique() );
+    sample.capply( [&m, &buffer](int x, size_t i, size_t j, size_t k){
+        BOOST_CHECK_EQUAL( x, buffer[m( i, j, k )] );
+    } );
+
+    // Fixed layouts are row-major
+    boost::container::array_md<char, 2, 5>  a;
+    auto const                               am = make_layout_mapping( a );
+
+    BOOST_CHECK_EQUAL( am.stride(0), 5u );
+    BOOST_CHECK_EQUAL( am.stride(1), 1u );
+    BOOST_CHECK_EQUAL( am( 1, 3 ), 8u );
+
+    using boost::container::dynamic_extent;
+    using boost::container::multiarray_shape;
+
+    boost::container::hybrid_multiarray<double, multiarray_shape<dynamic_extent,
+     3>>  h;
+
+    h.extents( {{ 4u, 3u }} );
+    auto const  hm = make_layout_mapping( h );
+
+    BOOST_CHECK_EQUAL( hm.extents().extent(0), 4u );
+    BOOST_CHECK_EQUAL( hm.stride(0), 3u );
+    BOOST_CHECK_EQUAL( hm.required_span_size(), 12u );
+
+    // The mapping keeps a narrow index type
+    multiarray<int, 2, std::vector<int>, std::uint32_t>  narrow( buffer );
+
+    narrow.extents( {{ 4u, 6u }} );
+    auto const  nm = make_layout_mapping( narrow );
+
+    BOOST_CHECK( (std::is_same<decltype( nm.stride(0) ), std::uint32_t>::value)
+     );
+    BOOST_CHECK_EQUAL( nm.stride(0), 6u );
+    BOOST_CHECK_EQUAL( nm( 2, 1 ), 13u );
+
+    // Gaps aren't exhaustive
+    typedef boost::container::mdspan_extents<int, 2>  extents_type;
+
+    boost::container::mdspan_layout_mapping<extents_type> const  g(
+     extents_type(2, 3), {{ 4, 1 }} );
+
+    BOOST_CHECK_EQUAL( g.required_span_size(), 7 );
+    BOOST_CHECK( !g.is_exhaustive() );
+}
+
+BOOST_AUTO_TEST_CASE( test_ref_from_mapping )
+{
+    using boost::container::make_layout_mapping;
+    using boost::container::make_multiarray_ref;
+    using std::size_t;
+
+    int  buffer[ 24 ];
+
+    std::iota( buffer, buffer + 24, 0 );
+
+    // Round trip through a mapping keeps the priorities
+    boost::container::multiarray_ref<int, 3>  src( buffer, {{ 2u, 3u, 4u }},
+     {{ 1u, 0u, 2u }} );
+    auto                                       v = make_multiarray_ref( buffer,
+     make_layout_mapping(src) );
+
+    BOOST_CHECK( v.extents() == src.extents() );
+    BOOST_CHECK( v.priorities() == src.priorities() );
+    v.capply( [&src](int x, size_t i, size_t j, size_t k){
+        BOOST_CHECK_EQUAL( x, src(i, j, k) );
+    } );
+
+    // Unit extents don't constrain their strides
+    typedef boost::container::mdspan_extents<size_t, 2>  extents_type;
+    typedef boost::container::mdspan_layout_mapping<extents_type>  mapping_type;
+
+    auto  u = make_multiarray_ref( buffer, mapping_type(extents_type( 1u,
+     5u ), {{ 99u, 1u }}) );
+
+    BOOST_CHECK_EQUAL( u(0, 4), 4 );
+
+    // Non-dense layouts are rejected
+    BOOST_CHECK_THROW( make_multiarray_ref(buffer, mapping_type(extents_type(
+     2u, 3u ), {{ 4u, 1u }})), std::invalid_argument );
+    BOOST_CHECK_THROW( make_multiarray_ref(buffer, mapping_type(extents_type(
+     2u, 3u ), {{ 3u, 3u }})), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_mapping_basics
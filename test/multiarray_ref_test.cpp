@@ -0,0 +1,115 @@
+//  Boost Multi-dimensional Array Reference unit test program file  ---------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray_ref.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+// Unit tests for basic functionality  ---------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_ref_basics )
+
+BOOST_AUTO_TEST_CASE( test_ref_foreign_buffer )
+{
+    using boost::container::multiarray_ref;
+    using std::size_t;
+
+    int  buffer[ 12 ];
+
+    std::iota( buffer, buffer + 12, 0 );
+
+    // Row-major view
+    multiarray_ref<int, 2>  rm( buffer, {{ 3u, 4u }} );
+    auto const &            rr = rm;
+
+    BOOST_CHECK_EQUAL( rr.size(), 12u );
+    BOOST_CHECK_EQUAL( rr.required_size(), 12u );
+    BOOST_CHECK( rr.data() == buffer );
+    BOOST_CHECK( rm.data() == buffer );
+    static_assert( std::is_same<decltype(rr.data()), int const *>::value,
+     "A const view must not give mutable access" );
+    BOOST_CHECK_EQUAL( rr(1, 2), 6 );
+    BOOST_CHECK_EQUAL( rr[2][3], 11 );
+    BOOST_CHECK_THROW( rr.at(3, 0), std::out_of_range );
+
+    // Writes go straight to the buffer
+    rm( 0, 1 ) = -1;
+    BOOST_CHECK_EQUAL( buffer[1], -1 );
+
+    // Column-major view of the same memory
+    multiarray_ref<int, 2>  cm( buffer, {{ 4u, 3u }}, {{ 1u, 0u }} );
+
+    BOOST_CHECK_EQUAL( cm(2, 1), rr(1, 2) );
+    cm.apply( [&rr](int x, size_t i, size_t j){
+        BOOST_CHECK_EQUAL( x, rr(j, i) );
+    } );
+    cm.fill( 3 );
+    BOOST_CHECK_EQUAL( std::count(buffer, buffer + 12, 3), 12 );
+
+    // Read-only view
+    std::vector<double> const        data( 8u, 1.5 );
+    multiarray_ref<double const, 3>  ro( data.data(), {{ 2u, 2u, 2u }} );
+
+    BOOST_CHECK( (std::is_same<decltype( ro(1, 1, 1) ), double const
+     &>::value) );
+    BOOST_CHECK_EQUAL( ro.at(1, 0, 1), 1.5 );
+
+    // Copies share the memory
+    multiarray_ref<int, 2>  copy = rm;
+
+    copy( 2, 2 ) = 99;
+    BOOST_CHECK_EQUAL( rr(2, 2), 99 );
+    BOOST_CHECK_THROW( (multiarray_ref<int, 2>( buffer, {{ 0u, 4u }} )),
+     std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE( test_ref_array_md )
+{
+    using boost::container::array_md;
+    using boost::container::make_multiarray_ref;
+    using std::size_t;
+
+    array_md<int, 2, 3, 4>  sample;
+
+    std::iota( sample.begin(), sample.end(), 0 );
+
+    auto  v = make_multiarray_ref( sample );
+
+    BOOST_CHECK( (std::is_same<decltype( v ),
+     boost::container::multiarray_ref<int, 3>>::value) );
+    BOOST_CHECK_EQUAL( v.extents()[0], 2u );
+    BOOST_CHECK_EQUAL( v.extents()[2], 4u );
+    v.capply( [&sample](int x, size_t i, size_t j, size_t k){
+        BOOST_CHECK_EQUAL( x, sample[i][j][k] );
+    } );
+    v( 1, 2, 3 ) = -7;
+    BOOST_CHECK_EQUAL( sample[1][2][3], -7 );
+
+    auto const &  cs = sample;
+    auto          cv = make_multiarray_ref( cs );
+
+    BOOST_CHECK( (std::is_same<decltype( cv ),
+     boost::container::multiarray_ref<int const, 3>>::value) );
+    BOOST_CHECK_EQUAL( cv[1][2][3], -7 );
+
+    array_md<long>  scalar{ 5L };
+    auto            sv = make_multiarray_ref( scalar );
+
+    BOOST_CHECK_EQUAL( sv(), 5L );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_ref_basics
@@ -0,0 +1,125 @@
+//  Boost Multi-dimensional Array Search unit test program file  ------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray_search.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// Unit tests for searching elements  ----------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_search_basics )
+
+BOOST_AUTO_TEST_CASE( test_find_and_count )
+{
+    using boost::container::multiarray;
+    using std::size_t;
+
+    typedef multiarray<int, 3>::stats_type  index_type;
+
+    // Enough elements to span several blocks, matches only in a late one
+    multiarray<int, 3>  a( std::vector<int>(420u) );
+
+    a.extents( {{ 6u, 7u, 10u }} );
+    a.apply( [](int &x, size_t i, size_t j, size_t k){ x = int(i * 70u + j *
+     10u + k); } );
+
+    auto const  big = []( int x ){ return x >= 333; };
+    auto const  r = find_if( a, big );
+
+    BOOST_CHECK( r );
+    BOOST_CHECK( (r.index == index_type{{ 4u, 5u, 3u }}) );
+    BOOST_CHECK( !find_if(a, [](int x){ return x < 0; }) );
+    BOOST_CHECK( any_of(a, big) );
+    BOOST_CHECK( !all_of(a, big) );
+    BOOST_CHECK( all_of(a, [](int x){ return x < 420; }) );
+    BOOST_CHECK_EQUAL( count_if(a, big), 87u );
+    BOOST_CHECK_EQUAL( count_if(a, [](int x){ return x % 2; }), 210u );
+
+    // Memory order follows the priorities
+    multiarray<int, 2>  b( std::vector<int>{0, 1, 1, 0, 0, 0} );
+
+    b.extents_and_priorities( {{ 2u, 3u }}, {{ 1u, 0u }} );
+    BOOST_CHECK( b(1, 0) && b(0, 1) );
+    BOOST_CHECK( (find_if( b, [](int x){ return x; } ).index ==
+     std::array<size_t, 2>{{ 1u, 0u }}) );
+
+    // Containers short of the extents are refused
+    b.extents( {{ 3u, 3u }} );
+    BOOST_CHECK_THROW( find_if(b, [](int x){ return x; }), std::length_error );
+    BOOST_CHECK_THROW( all_of(b, [](int x){ return x; }), std::length_error );
+    BOOST_CHECK_THROW( count_if(b, [](int x){ return x; }),
+     std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_argmin_argmax )
+{
+    using boost::container::array_md;
+    using boost::container::multiarray;
+    using std::size_t;
+
+    typedef multiarray<double, 2>::stats_type  index_type;
+
+    // Ties go to the first in memory order
+    multiarray<double, 2>  a( std::vector<double>(200u) );
+
+    a.extents( {{ 10u, 20u }} );
+    a.apply( [](double &x, size_t i, size_t j){ x = double( (i * 20u + j) * 37u
+     % 97u ); } );
+    a( 7, 3 ) = -5.0;
+    a( 8, 1 ) = -5.0;
+    a( 2, 2 ) = 500.0;
+
+    BOOST_CHECK( (argmin( a ) == index_type{{ 7u, 3u }}) );
+    BOOST_CHECK( (argmax( a ) == index_type{{ 2u, 2u }}) );
+    BOOST_CHECK( (argmin( a, std::greater<double>() ) == index_type{{ 2u, 2u
+     }}) );
+
+    multiarray<double, 2>  short_a( std::vector<double>(5u) );
+
+    short_a.extents( {{ 2u, 3u }} );
+    BOOST_CHECK_THROW( argmax(short_a), std::length_error );
+
+    // Built-in style arrays
+    array_md<std::string, 2, 2>  s{ {"pear", "fig", "apple", "fig"} };
+
+    BOOST_CHECK( (argmin( s ) == std::array<size_t, 2>{{ 1u, 0u }}) );
+    BOOST_CHECK( (argmax( s ) == std::array<size_t, 2>{{ 0u, 0u }}) );
+    BOOST_CHECK_EQUAL( count_if(s, [](std::string const &x){ return x ==
+     "fig"; }), 2u );
+    BOOST_CHECK( (find_if( s, [](std::string const &x){ return x.size() > 4u;
+     } ).index == std::array<size_t, 2>{{ 1u, 0u }}) );
+    BOOST_CHECK( any_of(s, [](std::string const &x){ return x == "pear"; }) );
+    BOOST_CHECK( !all_of(s, [](std::string const &x){ return x == "fig"; }) );
+
+    // Arrays with a narrow index type
+    typedef std::array<std::uint32_t, 2>  narrow_index_type;
+
+    multiarray<int, 2, std::vector<int>, std::uint32_t>  n( std::vector<int>{
+     4, 9, 1, 7, 3, 9 } );
+
+    n.extents( {{ 2u, 3u }} );
+    BOOST_CHECK( (argmin( n ) == narrow_index_type{{ 0u, 2u }}) );
+    BOOST_CHECK( (argmax( n ) == narrow_index_type{{ 0u, 1u }}) );
+    BOOST_CHECK( (find_if( n, [](int x){ return x == 3; } ).index ==
+     narrow_index_type{{ 1u, 1u }}) );
+    BOOST_CHECK_EQUAL( count_if(n, [](int x){ return x > 3; }), 4u );
+    BOOST_CHECK( any_of(n, [](int x){ return x == 7; }) );
+    BOOST_CHECK( all_of(n, [](int x){ return x > 0; }) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_search_basics
@@ -0,0 +1,124 @@
+//  Boost Multi-dimensional Array Snapshot unit test program file  ----------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray.hpp"
+#include "boost/container/multiarray_snapshot.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+// Unit tests for snapshot publishing  ---------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_snapshot_basics )
+
+BOOST_AUTO_TEST_CASE( test_snapshot_versions )
+{
+    using boost::container::multiarray;
+    using boost::container::multiarray_snapshot;
+
+    typedef multiarray<int, 2>  array_type;
+
+    multiarray_snapshot<array_type>  holder( array_type(std::vector<int>(6u, 1))
+     );
+    auto const                       first = holder.load();
+
+    BOOST_CHECK_EQUAL( (*first)(0, 0), 1 );
+
+    // Old snapshots are unaffected by later versions
+    auto        second = holder.update( [](array_type &a){ a.fill(2); } );
+
+    BOOST_CHECK_EQUAL( (*first)(3, 0), 1 );
+    BOOST_CHECK_EQUAL( (*holder.load())(3, 0), 2 );
+    BOOST_CHECK( holder.load() == second );
+
+    // Conditional publishing
+    auto  expected = first;
+
+    BOOST_CHECK( !holder.compare_and_publish(expected, first) );
+    BOOST_CHECK( expected == second );
+    BOOST_CHECK( holder.compare_and_publish(expected, first) );
+    BOOST_CHECK( holder.load() == first );
+
+    // The holder lets go of replaced versions
+    std::weak_ptr<array_type const> const  gone = second;
+
+    expected.reset();
+    holder.publish( array_type(std::vector<int>(6u, 3)) );
+    BOOST_CHECK( !gone.expired() );
+    second.reset();
+    BOOST_CHECK( gone.expired() );
+}
+
+BOOST_AUTO_TEST_CASE( test_snapshot_concurrency )
+{
+    using boost::container::multiarray;
+    using boost::container::multiarray_snapshot;
+
+    typedef multiarray<long, 2>  array_type;
+
+    multiarray_snapshot<array_type>  holder( array_type(std::vector<long>(64u))
+     );
+    std::atomic<bool>                done( false );
+    std::atomic<int>                 torn( 0 );
+    std::vector<std::thread>         readers;
+
+    // Each version has all elements equal; readers must never see a mix.
+    for ( int  r = 0 ; r < 4 ; ++r )
+        readers.emplace_back( [&](){
+            while ( !done )
+            {
+                auto const  s = holder.load();
+                auto const  v = *s->begin();
+
+                if ( !std::all_of(s->begin(), s->end(), [v](long x){ return x ==
+                 v; }) )
+                    ++torn;
+            }
+        } );
+    for ( long  version = 1 ; version <= 500 ; ++version )
+        holder.update( [version](array_type &a){ a.fill(version); } );
+    done = true;
+    for ( auto &t : readers )
+        t.join();
+    BOOST_CHECK_EQUAL( torn.load(), 0 );
+    BOOST_CHECK_EQUAL( *holder.load()->begin(), 500 );
+
+    // Writers racing with compare_and_publish lose no increments
+    std::vector<std::thread>  writers;
+
+    for ( int  w = 0 ; w < 3 ; ++w )
+        writers.emplace_back( [&holder](){
+            for ( int  n = 0 ; n < 200 ; ++n )
+            {
+                auto  expected = holder.load();
+
+                for ( ;; )
+                {
+                    array_type  next( *expected );
+
+                    next.apply( [](long &x, std::size_t, std::size_t){ ++x; } );
+                    if ( holder.compare_and_publish(expected, std::make_shared<
+                     array_type const>(std::move( next ))) )
+                        break;
+                }
+            }
+        } );
+    for ( auto &t : writers )
+        t.join();
+    BOOST_CHECK_EQUAL( *holder.load()->begin(), 1100 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_snapshot_basics
@@ -11,10 +11,12 @@
 #include <boost/mpl/list.hpp>
 
 #include "boost/container/multiarray.hpp"
+#include "boost/utility/slice.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <iterator>
 #include <limits>
@@ -318,6 +320,92 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_indexing, T, test_types )
     BOOST_CHECK_EQUAL( cc(0, 1), (T)73 );
 }
 
+BOOST_AUTO_TEST_CASE( test_chained_indexing )
+{
+    using boost::container::multiarray;
+    using boost::slice;
+    using boost::checked_slice;
+    using std::out_of_range;
+
+    multiarray<int, 3>  sample( std::vector<int>(24u) );
+    auto const &        ss = sample;
+
+    sample.extents_and_priorities( {{ 2u, 3u, 4u }}, {{ 1u, 2u, 0u }} );
+    sample.apply( [](int &x, std::size_t i, std::size_t j, std::size_t k){
+        x = static_cast<int>( 100 * i + 10 * j + k );
+    } );
+
+    // Each partial index gives a proxy, reporting the next extent
+    BOOST_CHECK_EQUAL( sample[1].size(), 3u );
+    BOOST_CHECK_EQUAL( sample[1][2].size(), 4u );
+    BOOST_CHECK_EQUAL( sample[1][2][3], 123 );
+    BOOST_CHECK_EQUAL( ss[0][1][2], 12 );
+    BOOST_CHECK( &sample[1][0][3] == &sample(1, 0, 3) );
+    sample[0][2][1] = -1;
+    BOOST_CHECK_EQUAL( ss(0, 2, 1), -1 );
+    BOOST_CHECK_EQUAL( (ss[{ 0, 2, 1 }]), -1 );
+
+    // The slicing functions work, including partial depth
+    BOOST_CHECK_EQUAL( slice(ss, 1, 1, 1), 111 );
+    BOOST_CHECK_EQUAL( slice(sample, 1, 2)[0], 120 );
+    slice( sample, 1, 1, 0 ) = -2;
+    BOOST_CHECK_EQUAL( ss(1, 1, 0), -2 );
+    BOOST_CHECK_EQUAL( checked_slice(out_of_range{ "" }, ss, 1, 2, 3), 123 );
+    BOOST_CHECK_THROW( checked_slice(out_of_range{ "" }, ss, 2, 0, 0),
+     out_of_range );
+    BOOST_CHECK_THROW( checked_slice(out_of_range{ "" }, sample, 1, 3, 0),
+     out_of_range );
+    BOOST_CHECK_THROW( checked_slice(out_of_range{ "" }, ss, 1, 0, 4),
+     out_of_range );
+
+    // One dimension goes straight to the element
+    multiarray<int, 1, std::deque<int>>  line( std::deque<int>{5, 6, 7} );
+
+    BOOST_CHECK_EQUAL( line[2], 7 );
+    line[ 0 ] = 4;
+    BOOST_CHECK_EQUAL( line(0), 4 );
+}
+
+BOOST_AUTO_TEST_CASE( test_narrow_index_type )
+{
+    using boost::container::multiarray;
+    using std::is_same;
+    using std::uint16_t;
+
+    typedef multiarray<double, 3, std::vector<double>, uint16_t>  sample_type;
+
+    BOOST_REQUIRE( (is_same<sample_type::index_type, uint16_t>::value) );
+    BOOST_REQUIRE( (is_same<sample_type::size_type, std::vector<double>::
+     size_type>::value) );
+    BOOST_REQUIRE( (is_same<sample_type::stats_type, std::array<uint16_t,
+     3>>::value) );
+
+    // Works like the default, with the tables in the narrow type
+    sample_type  sample( std::vector<double>(60u) );
+
+    sample.extents_and_priorities( {{ 3u, 4u, 5u }}, {{ 2u, 0u, 1u }} );
+    BOOST_CHECK_EQUAL( sample.required_size(), 60u );
+    sample.apply( [](double &x, uint16_t i, uint16_t j, uint16_t k){
+        x = 100. * i + 10. * j + k;
+    } );
+    BOOST_CHECK_EQUAL( sample(2, 3, 4), 234. );
+    BOOST_CHECK_EQUAL( sample.at(1, 0, 3), 103. );
+    BOOST_CHECK_EQUAL( sample[2][1][0], 210. );
+    BOOST_CHECK_THROW( sample.at(3, 0, 0), std::out_of_range );
+    BOOST_CHECK_EQUAL( boost::checked_slice(std::out_of_range{ "" }, sample, 2,
+     1, 0), 210. );
+    BOOST_CHECK_THROW( boost::checked_slice(std::out_of_range{ "" }, sample, 3,
+     0, 0), std::out_of_range );
+    BOOST_CHECK_EQUAL( std::count(sample.begin(), sample.end(), 0.), 1 );
+
+    // Shapes or containers too big for the index type are rejected
+    BOOST_CHECK_THROW( sample.extents({{ 256u, 256u, 2u }}), std::overflow_error
+     );
+    BOOST_CHECK_EQUAL( sample.required_size(), 60u );
+    BOOST_CHECK_THROW( sample_type(std::vector<double>( 70000u )),
+     std::overflow_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_basics
 
 
@@ -397,6 +485,41 @@ BOOST_AUTO_TEST_CASE( test_apply )
     BOOST_CHECK_EQUAL( sample_cm(1u, 2u), -5 );
 }
 
+BOOST_AUTO_TEST_CASE( test_iterators )
+{
+    using boost::container::multiarray;
+    using std::size_t;
+
+    // The range is limited to the elements needed
+    multiarray<int, 2>  sample( std::vector<int>{5, 3, 4, 1, 2, 0, 9, 8} );
+    auto const &        ss = sample;
+
+    sample.extents( {{ 2u, 3u }} );
+    BOOST_CHECK_EQUAL( std::distance(sample.begin(), sample.end()), 6 );
+    BOOST_CHECK( ss.cbegin() == ss.begin() && ss.cend() == ss.end() );
+    BOOST_CHECK( sample.data() == &sample(0, 0) );
+    BOOST_CHECK( ss.data() + 5 == &ss(1, 2) );
+
+    std::sort( sample.begin(), sample.end() );
+    BOOST_CHECK_EQUAL( ss(0, 0), 0 );
+    BOOST_CHECK_EQUAL( ss(1, 2), 5 );
+    BOOST_CHECK_EQUAL( *ss.end(), 9 );  // untouched
+
+    // Memory order matches "apply"
+    auto  i = ss.begin();
+
+    sample.priorities( {{ 1u, 0u }} );
+    ss.apply( [&i](int x, size_t, size_t){ BOOST_CHECK_EQUAL(x, *i++); } );
+    BOOST_CHECK( i == ss.end() );
+
+    // Too-short containers limit the range
+    multiarray<int, 2, std::deque<int>>  short_sample( std::deque<int>{1, 2} );
+
+    short_sample.extents( {{ 2u, 2u }} );
+    BOOST_CHECK_EQUAL( std::distance(short_sample.cbegin(), short_sample.cend()),
+     2 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_iteration
 
 
@@ -590,3 +713,112 @@ BOOST_AUTO_TEST_CASE( test_subclassing )
 }
 
 BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_operations
+
+
+// Unit tests for the circular variant  --------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_ring_multiarray )
+
+BOOST_AUTO_TEST_CASE( test_ring_indexing )
+{
+    using boost::container::ring_multiarray;
+    using std::size_t;
+
+    // Three frames of 2 x 2 data, the frame index being most major
+    ring_multiarray<int, 3>  sample( std::vector<int>(12u) );
+    auto const &             ss = sample;
+
+    sample.extents( 3u, 2u, 2u );
+    BOOST_CHECK_EQUAL( ss.rotating_axis(), 0u );
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+    sample.apply( [](int &x, size_t f, size_t r, size_t c){
+        x = static_cast<int>( 100 * f + 10 * r + c );
+    } );
+    BOOST_CHECK_EQUAL( ss(0u, 0u, 0u), 0 );
+    BOOST_CHECK_EQUAL( ss(2u, 1u, 1u), 211 );
+
+    // Slide the window; the oldest frame becomes the newest one
+    sample.advance();
+    BOOST_CHECK_EQUAL( ss.head(), 1u );
+    BOOST_CHECK_EQUAL( ss(0u, 0u, 1u), 101 );
+    BOOST_CHECK_EQUAL( ss(1u, 1u, 0u), 210 );
+    BOOST_CHECK_EQUAL( ss.at(2u, 0u, 0u), 0 );
+    sample( 2u, 0u, 0u ) = 300;
+    sample.at( {2u, 1u, 1u} ) = 311;
+    BOOST_CHECK_THROW( ss.at(3u, 0u, 0u), std::out_of_range );
+
+    // Logical indexes are given, even in memory order
+    sample.capply( [&ss](int x, size_t f, size_t r, size_t c){
+        BOOST_CHECK_EQUAL( x, ss(f, r, c) );
+    } );
+
+    // Logical order visits the oldest frame first
+    std::vector<int>  visited;
+
+    ss.capply_in_order( [&visited](int x, size_t, size_t, size_t){
+        visited.push_back( x );
+    } );
+    BOOST_REQUIRE_EQUAL( visited.size(), 12u );
+    BOOST_CHECK_EQUAL( visited.front(), 100 );
+    BOOST_CHECK_EQUAL( visited[4], 200 );
+    BOOST_CHECK_EQUAL( visited[8], 300 );
+    BOOST_CHECK_EQUAL( visited.back(), 311 );
+
+    // Wrap all the way around
+    sample.advance( 5u );
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+    BOOST_CHECK_EQUAL( ss(0u, 0u, 0u), 300 );
+    BOOST_CHECK_EQUAL( ss(1u, 0u, 0u), 100 );
+
+    // Reshaping resets the ring
+    sample.advance();
+    sample.extents( 2u, 3u, 2u );
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+
+    // So does changing the memory order
+    sample.advance();
+    BOOST_CHECK_EQUAL( ss.head(), 1u );
+    sample.use_column_major_order();
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+    sample.advance();
+    BOOST_CHECK_EQUAL( ss.head(), 1u );
+    sample.use_row_major_order();
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+    sample.advance();
+    BOOST_CHECK_EQUAL( ss.head(), 1u );
+    sample.priorities( 1u, 0u, 2u );
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+    BOOST_CHECK( (ss.priorities() == std::array<size_t, 3>{{ 1u, 0u, 2u }}) );
+}
+
+BOOST_AUTO_TEST_CASE( test_ring_inner_axis )
+{
+    using boost::container::ring_multiarray;
+    using std::size_t;
+
+    ring_multiarray<int, 2, std::array<int, 6>>  sample;
+    auto const &                                 ss = sample;
+
+    sample.extents( 2u, 3u );
+    sample.apply( [](int &x, size_t r, size_t c){
+        x = static_cast<int>( 10 * r + c );
+    } );
+    BOOST_CHECK_THROW( sample.rotating_axis(2u), std::out_of_range );
+    sample.rotating_axis( 1u );
+    sample.advance( 2u );
+    BOOST_CHECK_EQUAL( ss(0u, 0u), 2 );
+    BOOST_CHECK_EQUAL( ss(0u, 1u), 0 );
+    BOOST_CHECK_EQUAL( ss(1u, 2u), 11 );
+
+    // Swapping takes the ring state too
+    ring_multiarray<int, 2, std::array<int, 6>>  other;
+
+    using std::swap;
+    swap( sample, other );
+    BOOST_CHECK_EQUAL( other.rotating_axis(), 1u );
+    BOOST_CHECK_EQUAL( other.head(), 2u );
+    BOOST_CHECK_EQUAL( other(1u, 0u), 12 );
+    BOOST_CHECK_EQUAL( ss.head(), 0u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_ring_multiarray
@@ -0,0 +1,125 @@
+//  Boost Multi-dimensional Array Text I/O unit test program file  ----------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/multiarray_text.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// Unit tests for text reading and writing  ----------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_multiarray_text_basics )
+
+BOOST_AUTO_TEST_CASE( test_read_text )
+{
+    using boost::container::multiarray;
+    using boost::container::read_text;
+    using boost::container::write_text;
+
+    // Shape inference, mixed delimiters, blank lines
+    std::istringstream  csv( "1,2,3\n\n4, 5 ,6\r\n-7\t8;9\n" );
+    auto const          m = read_text<int>( csv );
+
+    BOOST_CHECK_EQUAL( m.extents()[0], 3u );
+    BOOST_CHECK_EQUAL( m.extents()[1], 3u );
+    BOOST_CHECK_EQUAL( m(1, 1), 5 );
+    BOOST_CHECK_EQUAL( m(2, 0), -7 );
+
+    // Existing shape, filled in row-major order despite column-major memory
+    multiarray<double, 3>  cube( std::vector<double>(8u) );
+    std::istringstream     column( "0.5\n1\n2\n3\n4\n5\n6\n7.25e1\n" );
+
+    cube.extents_and_priorities( {{ 2u, 2u, 2u }}, {{ 2u, 1u, 0u }} );
+    read_text( column, cube, 3u );
+    BOOST_CHECK_EQUAL( cube(0, 0, 0), 0.5 );
+    BOOST_CHECK_EQUAL( cube(0, 1, 0), 2. );
+    BOOST_CHECK_EQUAL( cube(1, 1, 1), 72.5 );
+
+    // Errors
+    std::istringstream  ragged( "1 2\n3\n" ), bad( "1 x\n" ), big( "300\n" ),
+                        short_text( "1 2 3\n" );
+    multiarray<unsigned char, 1>  small( std::vector<unsigned char>(1u) );
+
+    BOOST_CHECK_THROW( read_text<int>(ragged), std::invalid_argument );
+    BOOST_CHECK_THROW( read_text<int>(bad), std::invalid_argument );
+    BOOST_CHECK_THROW( read_text(big, small), std::out_of_range );
+    BOOST_CHECK_THROW( read_text(short_text, cube), std::invalid_argument );
+
+    std::istringstream  nine( "1 2 3\n4 5 6\n7 8 9\n" );
+    std::ostringstream  sink;
+
+    cube.extents( {{ 3u, 3u, 1u }} );  // more than the 8 elements held
+    BOOST_CHECK_THROW( read_text(nine, cube), std::length_error );
+    BOOST_CHECK_THROW( write_text(sink, cube), std::length_error );
+}
+
+BOOST_AUTO_TEST_CASE( test_write_text )
+{
+    using boost::container::array_md;
+    using boost::container::multiarray;
+    using boost::container::read_text;
+    using boost::container::write_text;
+
+    array_md<int, 2, 3>  sample{ {{ 1, -2, 3 }, { 40, 50, 60 }} };
+    std::ostringstream   out;
+
+    write_text( out, sample, ',' );
+    BOOST_CHECK_EQUAL( out.str(), "1,-2,3\n40,50,60\n" );
+
+    // Round trip, including memory order and floating-point precision
+    multiarray<double, 2>  m( std::vector<double>(6u) );
+
+    m.extents_and_priorities( {{ 3u, 2u }}, {{ 1u, 0u }} );
+    m.apply( [](double &x, std::size_t i, std::size_t j){
+        x = 1. / (1. + static_cast<double>( 2u * i + j ));
+    } );
+
+    std::stringstream  trip;
+
+    write_text( trip, m );
+
+    auto const  copy = read_text<double>( trip );
+
+    BOOST_CHECK( copy.extents() == m.extents() );
+    m.capply( [&copy](double x, std::size_t i, std::size_t j){
+        BOOST_CHECK_EQUAL( copy(i, j), x );
+    } );
+
+    // Reading back into a fixed array
+    array_md<int, 3, 2>  reshaped;
+    std::istringstream   in( out.str() );
+
+    read_text( in, reshaped );
+    BOOST_CHECK_EQUAL( reshaped[1][1], 40 );
+
+    std::ostringstream  per_line;
+
+    write_text( per_line, sample, ' ', 4u );
+    BOOST_CHECK_EQUAL( per_line.str(), "1 -2 3 40\n50 60\n" );
+
+    // Arrays with a narrow index type
+    multiarray<int, 2, std::vector<int>, std::uint16_t>  narrow( std::vector<
+     int>(6u) );
+    std::istringstream                                   from( out.str() );
+    std::ostringstream                                   to;
+
+    narrow.extents( {{ 2u, 3u }} );
+    read_text( from, narrow );
+    write_text( to, narrow, ',' );
+    BOOST_CHECK_EQUAL( to.str(), out.str() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_multiarray_text_basics
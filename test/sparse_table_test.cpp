@@ -0,0 +1,105 @@
+//  Boost Multi-dimensional Sparse Table unit test program file  ------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/sparse_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// Unit tests for box minimums and maximums  ---------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_sparse_table_basics )
+
+BOOST_AUTO_TEST_CASE( test_range_min_max )
+{
+    using boost::container::multiarray;
+    using boost::container::range_max_table;
+    using boost::container::range_min_table;
+    using std::size_t;
+
+    // Compare every box against brute force, with odd extents
+    multiarray<int, 3>  a( std::vector<int>(270u) );
+
+    a.extents( {{ 6u, 5u, 9u }} );
+    a.apply( [](int &x, size_t i, size_t j, size_t k){ x = int( (i * 31u + j *
+     17u + k * 13u) * 7u % 101u ); } );
+
+    range_min_table<int, 3> const  lo( a, std::less<int>(), 4u );
+    range_max_table<int, 3> const  hi( a );
+    bool                           all_match = true;
+
+    BOOST_CHECK( lo.extents() == a.extents() );
+    for ( size_t  i0 = 0u ; i0 < 6u ; ++i0 )
+    for ( size_t  i1 = i0 + 1u ; i1 <= 6u ; ++i1 )
+    for ( size_t  j0 = 0u ; j0 < 5u ; ++j0 )
+    for ( size_t  j1 = j0 + 1u ; j1 <= 5u ; ++j1 )
+    for ( size_t  k0 = 0u ; k0 < 9u ; k0 += 2u )
+    for ( size_t  k1 = k0 + 1u ; k1 <= 9u ; ++k1 )
+    {
+        int  least = a( i0, j0, k0 ), greatest = least;
+
+        for ( auto  i = i0 ; i < i1 ; ++i )
+            for ( auto  j = j0 ; j < j1 ; ++j )
+                for ( auto  k = k0 ; k < k1 ; ++k )
+                {
+                    least = std::min( least, a(i, j, k) );
+                    greatest = std::max( greatest, a(i, j, k) );
+                }
+        all_match = all_match && lo.query( {{i0, j0, k0}}, {{i1, j1, k1}} ) ==
+         least && hi.query( {{i0, j0, k0}}, {{i1, j1, k1}} ) == greatest;
+    }
+    BOOST_CHECK( all_match );
+    BOOST_CHECK_EQUAL( lo.query({{ 2u, 3u, 4u }}, {{ 3u, 4u, 5u }}), a(2, 3,
+     4) );
+
+    // Empty or oversized boxes
+    BOOST_CHECK_THROW( lo.query({{ 1u, 1u, 1u }}, {{ 1u, 2u, 2u }}),
+     std::out_of_range );
+    BOOST_CHECK_THROW( hi.query({{ 0u, 0u, 0u }}, {{ 6u, 5u, 10u }}),
+     std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE( test_sparse_table_sources )
+{
+    using boost::container::array_md;
+    using boost::container::sparse_table;
+
+    // Custom ordering on a built-in style source, extents of one included
+    auto const  shorter = []( std::string const &x, std::string const &y ){
+        return x.size() < y.size(); };
+    array_md<std::string, 1, 5>  words{ {"three", "a", "seven", "to", "be"} };
+    sparse_table<std::string, 2, decltype(shorter)>  t( words, shorter );
+
+    BOOST_CHECK_EQUAL( t.query({{ 0u, 0u }}, {{ 1u, 5u }}), "a" );
+    BOOST_CHECK_EQUAL( t.query({{ 0u, 2u }}, {{ 1u, 5u }}), "to" );
+    BOOST_CHECK_EQUAL( t.query({{ 0u, 2u }}, {{ 1u, 3u }}), "seven" );
+    BOOST_CHECK_EQUAL( t.table_size(), 1u * 1u * 5u * 3u );
+
+    // Sources with a narrow index type
+    boost::container::multiarray<int, 2, std::vector<int>, std::uint16_t>  n(
+     std::vector<int>{ 4, 2, 8, 6 } );
+
+    n.extents( {{ 2u, 2u }} );
+    sparse_table<int, 2> const  u( n );
+
+    BOOST_CHECK_EQUAL( u.query({{ 1u, 0u }}, {{ 2u, 2u }}), 6 );
+
+    // Sources whose containers are too small
+    n.extents( {{ 3u, 2u }} );
+    BOOST_CHECK_THROW( (sparse_table<int, 2>( n )), std::length_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_sparse_table_basics
@@ -0,0 +1,127 @@
+//  Boost Multi-dimensional Summed-Area Table unit test program file  ------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/summed_area_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+// Unit tests for summed-area tables  ----------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_summed_area_table_basics )
+
+BOOST_AUTO_TEST_CASE( test_sat_queries )
+{
+    using boost::container::multiarray;
+    using boost::container::summed_area_table;
+    using std::size_t;
+
+    BOOST_CHECK( (std::is_same<summed_area_table<unsigned char, 2>::value_type,
+     std::uintmax_t>::value) );
+    BOOST_CHECK( (std::is_same<summed_area_table<float, 2>::value_type,
+     double>::value) );
+
+    // Column-major source, with values that would overflow a "char" sum
+    multiarray<signed char, 3>  source( std::vector<signed char>(60u) );
+
+    source.extents_and_priorities( {{ 3u, 4u, 5u }}, {{ 2u, 0u, 1u }} );
+    source.apply( [](signed char &x, size_t i, size_t j, size_t k){
+        x = static_cast<signed char>( 120 - 7 * (int)i - 3 * (int)j + (int)k );
+    } );
+
+    summed_area_table<signed char, 3> const  sat( source, 2u );
+    auto const  brute = [&source](size_t a, size_t b, size_t c, size_t d,
+     size_t e, size_t f) -> long {
+        long  result = 0;
+
+        for ( auto  i = a ; i < d ; ++i )
+            for ( auto  j = b ; j < e ; ++j )
+                for ( auto  k = c ; k < f ; ++k )
+                    result += source( i, j, k );
+        return result;
+    };
+
+    BOOST_CHECK( sat.extents() == source.extents() );
+    BOOST_CHECK_EQUAL( sat.sum({{ 0u, 0u, 0u }}, {{ 3u, 4u, 5u }}),
+     brute(0, 0, 0, 3, 4, 5) );
+    BOOST_CHECK_EQUAL( sat.sum({{ 1u, 2u, 1u }}, {{ 3u, 4u, 4u }}),
+     brute(1, 2, 1, 3, 4, 4) );
+    BOOST_CHECK_EQUAL( sat.sum({{ 2u, 0u, 3u }}, {{ 3u, 1u, 4u }}),
+     source(2, 0, 3) );
+    BOOST_CHECK_EQUAL( sat.sum({{ 1u, 2u, 1u }}, {{ 1u, 4u, 4u }}), 0 );
+    BOOST_CHECK_THROW( sat.sum({{ 0u, 0u, 0u }}, {{ 3u, 5u, 5u }}),
+     std::out_of_range );
+    BOOST_CHECK_THROW( sat.sum({{ 2u, 0u, 0u }}, {{ 1u, 4u, 5u }}),
+     std::out_of_range );
+}
+
+BOOST_AUTO_TEST_CASE( test_sat_update )
+{
+    using boost::container::array_md;
+    using boost::container::multiarray;
+    using boost::container::summed_area_table;
+
+    array_md<int, 4, 5>  source;
+
+    for ( unsigned  i = 0u ; i < 4u ; ++i )
+        for ( unsigned  j = 0u ; j < 5u ; ++j )
+            source[ i ][ j ] = static_cast<int>( i * 5u + j );
+
+    summed_area_table<int, 2>  sat( source );
+
+    BOOST_CHECK_EQUAL( sat.sum({{ 0u, 0u }}, {{ 4u, 5u }}), 190 );
+
+    // Replace the 2-by-3 box at (1, 2) with a run-time array
+    multiarray<int, 2>  patch( std::vector<int>{ 1, -1, 2, -2, 3, -3 } );
+
+    patch.extents( {{ 2u, 3u }} );
+    sat.update( {{ 1u, 2u }}, patch );
+    for ( unsigned  i = 0u ; i < 2u ; ++i )
+        for ( unsigned  j = 0u ; j < 3u ; ++j )
+            source[ 1u + i ][ 2u + j ] = patch( i, j );
+
+    summed_area_table<int, 2> const  fresh( source );
+
+    BOOST_CHECK( sat.entries().extents() == fresh.entries().extents() );
+    BOOST_CHECK( std::equal(fresh.entries().begin(), fresh.entries().end(),
+     sat.entries().begin()) );
+
+    // Fixed-size patches work too, and must fit
+    array_md<int, 1, 1>  dot{ {{ 100 }} };
+
+    sat.update( {{ 3u, 4u }}, dot );
+    BOOST_CHECK_EQUAL( sat.sum({{ 3u, 4u }}, {{ 4u, 5u }}), 100 );
+    BOOST_CHECK_THROW( sat.update({{ 1u, 3u }}, patch), std::out_of_range );
+
+    // Sources and patches with a narrow index type
+    multiarray<int, 2, std::vector<int>, std::uint16_t>  narrow( std::vector<
+     int>{ 7, 8 } );
+
+    narrow.extents( {{ 1u, 2u }} );
+    sat.update( {{ 0u, 0u }}, narrow );
+    BOOST_CHECK_EQUAL( sat.sum({{ 0u, 0u }}, {{ 1u, 2u }}), 15 );
+    summed_area_table<int, 2> const  from_narrow( narrow );
+
+    BOOST_CHECK_EQUAL( from_narrow.sum({{ 0u, 1u }}, {{ 1u, 2u }}), 8 );
+
+    // Sources and patches whose containers are too small
+    narrow.extents( {{ 2u, 2u }} );
+    BOOST_CHECK_THROW( (summed_area_table<int, 2>( narrow )), std::length_error
+     );
+    BOOST_CHECK_THROW( sat.update({{ 0u, 0u }}, narrow), std::length_error );
+    BOOST_CHECK_EQUAL( sat.sum({{ 0u, 0u }}, {{ 1u, 2u }}), 15 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_summed_area_table_basics
@@ -0,0 +1,105 @@
+//  Boost Dirty-Tracking Multi-dimensional Array unit test program file  ----//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/container/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/container/tracked_multiarray.hpp"
+
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+
+// Unit tests for dirty tracking  --------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( test_tracked_multiarray_basics )
+
+BOOST_AUTO_TEST_CASE( test_dirty_marking )
+{
+    using boost::container::tracked_multiarray;
+    using std::size_t;
+
+    // 6-by-10 array in blocks of 16, so the last block is short
+    tracked_multiarray<int, 2, 16>  sample( {{ 6u, 10u }}, 0 );
+    auto const &                    ss = sample;
+
+    BOOST_CHECK_EQUAL( sample.block_count(), 4u );
+    BOOST_CHECK_EQUAL( sample.dirty_blocks().size(), 4u );
+    sample.clear_dirty();
+    BOOST_CHECK( sample.dirty_blocks().empty() );
+
+    // Reading doesn't flag
+    BOOST_CHECK_EQUAL( ss(5, 9), 0 );
+    ss.capply( [](int, size_t, size_t){} );
+    BOOST_CHECK( sample.dirty_blocks().empty() );
+
+    // Each kind of mutable access does
+    sample( 0, 3 ) = 1;                                    // offset 3
+    sample.at( 2, 1 ) = 2;                                 // offset 21
+    sample[ 5 ][ 9 ] = 3;                                  // offset 59
+    BOOST_CHECK( (sample.dirty_blocks() == std::vector<size_t>{ 0u, 1u, 3u }) );
+    BOOST_CHECK( !sample.is_dirty(2u) );
+
+    sample.clear_dirty();
+    sample.apply( [](int &x, size_t i, size_t){ if ( i == 3u ) x = 4; } );
+    BOOST_CHECK_EQUAL( sample.dirty_blocks().size(), 4u );  // all reached
+    sample.clear_dirty();
+    sample.fill( 5 );
+    BOOST_CHECK_EQUAL( sample.dirty_blocks().size(), 4u );
+
+    size_t  visited = 0u;
+
+    sample.for_each_dirty_block( [&visited](size_t b, int const *f, int const
+     *l){
+        BOOST_CHECK_EQUAL( l - f, b < 3u ? 16 : 12 );
+        ++visited;
+    } );
+    BOOST_CHECK_EQUAL( visited, 4u );
+}
+
+BOOST_AUTO_TEST_CASE( test_dirty_sync )
+{
+    using boost::container::tracked_multiarray;
+
+    tracked_multiarray<double, 2, 8>  primary( {{ 5u, 5u }}, 0. ),
+     replica( {{ 5u, 5u }}, 0. );
+    std::stringstream                 channel;
+
+    // First round sends everything
+    primary.fill( 1. );
+    BOOST_CHECK_EQUAL( primary.write_dirty_blocks(channel), 4u );
+    primary.clear_dirty();
+    BOOST_CHECK_EQUAL( replica.read_blocks(channel), 4u );
+    BOOST_CHECK_EQUAL( replica(4, 4), 1. );
+
+    // Later rounds send only what changed
+    std::stringstream  delta;
+
+    primary( 2, 1 ) = 7.;  // offset 11, block 1
+    BOOST_CHECK_EQUAL( primary.write_dirty_blocks(delta), 1u );
+    primary.clear_dirty();
+    BOOST_CHECK_EQUAL( delta.str().size(), 8u * 3u + 8u * sizeof(double) );
+    replica.clear_dirty();
+    BOOST_CHECK_EQUAL( replica.read_blocks(delta), 1u );
+    BOOST_CHECK_EQUAL( replica(2, 1), 7. );
+    BOOST_CHECK( (replica.dirty_blocks() == std::vector<std::size_t>{ 1u }) );
+
+    // Mismatched or cut-off streams are rejected
+    tracked_multiarray<double, 2, 8>  other( {{ 2u, 2u }}, 0. );
+    std::stringstream                 full, cut;
+
+    primary.mark_all_dirty();
+    primary.write_dirty_blocks( full );
+    BOOST_CHECK_THROW( other.read_blocks(full), std::invalid_argument );
+    cut.str( full.str().substr(0u, 40u) );
+    BOOST_CHECK_THROW( replica.read_blocks(cut), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // test_tracked_multiarray_basics